@@ -0,0 +1,80 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Collects the creation-to-read latency of each received packet, in microseconds
+class LatencyStatistics
+{
+public:
+    void add(int64_t latencyUs);
+    size_t getCount() const;
+
+    // `percentile` is in the range [0, 100]
+    int64_t getPercentile(double percentile);
+
+private:
+    std::vector<int64_t> latencies;
+    bool sorted = true;
+};
+
+// CPU time spent by this process and the utilization of each core over a measurement interval. The utilization
+// of cores is read from /proc/stat and is only available on Linux.
+class CpuStatistics
+{
+public:
+    void start();
+    void stop();
+
+    double getProcessCpuSeconds() const;
+    const std::vector<double>& getCoreUtilization() const;
+
+private:
+    struct CoreTimes
+    {
+        uint64_t busy;
+        uint64_t total;
+    };
+
+    std::clock_t processStart = 0;
+    std::clock_t processStop = 0;
+    std::vector<CoreTimes> coresStart;
+    std::vector<double> coreUtilization;
+
+    static std::vector<CoreTimes> readCoreTimes();
+};
+
+struct LoopbackResult
+{
+    std::string transport;
+    size_t signalCount = 0;
+    double sampleRate = 0.0;
+    std::chrono::duration<double> duration{};
+    uint64_t sampleCount = 0;
+    uint64_t byteCount = 0;
+    uint64_t packetCount = 0;
+    LatencyStatistics latency;
+    CpuStatistics cpu;
+};
+
+void printResult(std::ostream& stream, LoopbackResult& result);
@@ -0,0 +1,134 @@
+#include <streaming_loopback/loopback_statistics.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+void LatencyStatistics::add(int64_t latencyUs)
+{
+    latencies.push_back(latencyUs);
+    sorted = false;
+}
+
+size_t LatencyStatistics::getCount() const
+{
+    return latencies.size();
+}
+
+int64_t LatencyStatistics::getPercentile(double percentile)
+{
+    if (latencies.empty())
+        return 0;
+
+    if (!sorted)
+    {
+        std::sort(latencies.begin(), latencies.end());
+        sorted = true;
+    }
+
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(latencies.size())));
+    return latencies[std::clamp<size_t>(rank, 1, latencies.size()) - 1];
+}
+
+void CpuStatistics::start()
+{
+    processStart = std::clock();
+    coresStart = readCoreTimes();
+    coreUtilization.clear();
+}
+
+void CpuStatistics::stop()
+{
+    processStop = std::clock();
+
+    const auto coresStop = readCoreTimes();
+    if (coresStop.size() != coresStart.size())
+        return;
+
+    coreUtilization.resize(coresStop.size());
+    for (size_t i = 0; i < coresStop.size(); ++i)
+    {
+        const auto busy = coresStop[i].busy - coresStart[i].busy;
+        const auto total = coresStop[i].total - coresStart[i].total;
+        coreUtilization[i] = total > 0 ? 100.0 * static_cast<double>(busy) / static_cast<double>(total) : 0.0;
+    }
+}
+
+double CpuStatistics::getProcessCpuSeconds() const
+{
+    return static_cast<double>(processStop - processStart) / CLOCKS_PER_SEC;
+}
+
+const std::vector<double>& CpuStatistics::getCoreUtilization() const
+{
+    return coreUtilization;
+}
+
+std::vector<CpuStatistics::CoreTimes> CpuStatistics::readCoreTimes()
+{
+    std::vector<CoreTimes> cores;
+
+    std::ifstream stat("/proc/stat");
+    std::string line;
+    while (std::getline(stat, line))
+    {
+        // Per core lines are "cpuN user nice system idle iowait irq softirq steal ..."; the aggregate "cpu" line is skipped
+        if (line.compare(0, 3, "cpu") != 0 || line.size() < 4 || line[3] == ' ')
+            continue;
+
+        std::istringstream fields(line);
+        std::string name;
+        fields >> name;
+
+        uint64_t total = 0;
+        uint64_t idle = 0;
+        uint64_t value;
+        for (int field = 0; fields >> value; ++field)
+        {
+            total += value;
+            if (field == 3 || field == 4)
+                idle += value;
+        }
+
+        cores.push_back({total - idle, total});
+    }
+
+    return cores;
+}
+
+void printResult(std::ostream& stream, LoopbackResult& result)
+{
+    const auto seconds = result.duration.count();
+
+    stream << std::fixed << std::setprecision(1);
+    stream << "Transport: " << result.transport << std::endl;
+    stream << "  Signals: " << result.signalCount << " @ " << result.sampleRate << " Hz" << std::endl;
+    stream << "  Duration: " << seconds << " s, packets: " << result.packetCount << std::endl;
+    stream << "  Throughput: " << static_cast<double>(result.sampleCount) / seconds << " samples/s, "
+           << static_cast<double>(result.byteCount) / seconds << " bytes/s (payload)" << std::endl;
+
+    if (result.latency.getCount() > 0)
+    {
+        stream << "  Latency (creation to read): p50 " << result.latency.getPercentile(50.0) << " us, p99 "
+               << result.latency.getPercentile(99.0) << " us, p999 " << result.latency.getPercentile(99.9) << " us" << std::endl;
+    }
+    else
+    {
+        stream << "  Latency (creation to read): n/a" << std::endl;
+    }
+
+    stream << "  Process CPU: " << result.cpu.getProcessCpuSeconds() / seconds * 100.0 << " %" << std::endl;
+
+    const auto& cores = result.cpu.getCoreUtilization();
+    if (cores.empty())
+    {
+        stream << "  Core utilization: n/a" << std::endl;
+        return;
+    }
+
+    stream << "  Core utilization:";
+    for (size_t i = 0; i < cores.size(); ++i)
+        stream << " cpu" << i << " " << cores[i] << " %";
+    stream << std::endl;
+}
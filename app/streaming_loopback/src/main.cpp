@@ -0,0 +1,266 @@
+#include <streaming_loopback/loopback_statistics.h>
+#include <opendaq/opendaq.h>
+#include <opendaq/reader_utils.h>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace daq;
+using namespace std::chrono;
+
+namespace
+{
+
+struct Options
+{
+    std::vector<std::string> transports;
+    std::string modulePath;
+    Int signalCount = 2;
+    Float sampleRate = 1000.0;
+    Int loopTime = 20;
+    double duration = 10.0;
+    double warmup = 2.0;
+    Int pollInterval = 1;
+};
+
+struct Transport
+{
+    std::string name;
+    std::vector<std::string> serverTypes;
+    std::string connectionString;
+    // Primary streaming protocol of the OPC UA client device; empty for pure streaming connections
+    std::string primaryStreamingProtocol;
+};
+
+const std::vector<Transport> transports = {
+    {"native", {"openDAQ Native Streaming"}, "daq.nd://127.0.0.1", ""},
+    {"websocket", {"openDAQ WebsocketTcp Streaming"}, "daq.ws://127.0.0.1", ""},
+    {"opcua-native", {"openDAQ Native Streaming", "openDAQ OpcUa"}, "daq.opcua://127.0.0.1", "daq.ns"},
+    {"opcua-websocket", {"openDAQ WebsocketTcp Streaming", "openDAQ OpcUa"}, "daq.opcua://127.0.0.1", "daq.wss"},
+};
+
+void printUsage(std::ostream& stream)
+{
+    stream << "Usage: opendaq_streaming_loopback [options]" << std::endl
+           << "  --transport <name>     native, websocket, opcua-native, opcua-websocket or all (repeatable, default all)" << std::endl
+           << "  --signals <count>      number of reference device channels to subscribe (default 2)" << std::endl
+           << "  --rate <Hz>            sample rate of the reference device (default 1000)" << std::endl
+           << "  --loop-time <ms>       acquisition loop time of the reference device (default 20)" << std::endl
+           << "  --duration <s>         measurement duration per transport (default 10)" << std::endl
+           << "  --warmup <s>           time to discard before measuring (default 2)" << std::endl
+           << "  --poll-interval <ms>   reader poll interval, adds to the measured latency (default 1)" << std::endl
+           << "  --module-path <path>   module search path (default: the executable directory)" << std::endl;
+}
+
+bool parseOptions(int argc, const char* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+            return false;
+
+        if (i + 1 >= argc)
+        {
+            std::cerr << "Missing value for " << arg << std::endl;
+            return false;
+        }
+
+        const std::string value = argv[++i];
+        if (arg == "--transport")
+        {
+            if (value == "all")
+            {
+                for (const auto& transport : transports)
+                    options.transports.push_back(transport.name);
+            }
+            else
+            {
+                options.transports.push_back(value);
+            }
+        }
+        else if (arg == "--signals")
+            options.signalCount = std::stoll(value);
+        else if (arg == "--rate")
+            options.sampleRate = std::stod(value);
+        else if (arg == "--loop-time")
+            options.loopTime = std::stoll(value);
+        else if (arg == "--duration")
+            options.duration = std::stod(value);
+        else if (arg == "--warmup")
+            options.warmup = std::stod(value);
+        else if (arg == "--poll-interval")
+            options.pollInterval = std::stoll(value);
+        else if (arg == "--module-path")
+            options.modulePath = value;
+        else
+        {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+
+    if (options.transports.empty())
+    {
+        for (const auto& transport : transports)
+            options.transports.push_back(transport.name);
+    }
+
+    return true;
+}
+
+struct SubscribedSignal
+{
+    PacketReaderPtr reader;
+    system_clock::time_point epoch;
+    RatioPtr resolution;
+};
+
+std::vector<SubscribedSignal> subscribe(const DevicePtr& device)
+{
+    std::vector<SubscribedSignal> subscribed;
+    for (const auto& signal : device.getSignalsRecursive())
+    {
+        // Only the channel value signals; the device also publishes load generator and CAN signals
+        const auto descriptor = signal.getDescriptor();
+        if (!descriptor.assigned() || !signal.getDomainSignal().assigned())
+            continue;
+        if (descriptor.getName().toStdString().rfind("AI ", 0) != 0)
+            continue;
+
+        const auto domainDescriptor = signal.getDomainSignal().getDescriptor();
+        subscribed.push_back({PacketReader(signal), reader::parseEpoch(domainDescriptor.getOrigin()), domainDescriptor.getTickResolution()});
+    }
+
+    return subscribed;
+}
+
+// Reads all queued packets. The reference device stamps the domain of each packet with the wall clock time at which
+// its last sample was created, so the difference to the time of reading is the end-to-end latency of the packet.
+void poll(std::vector<SubscribedSignal>& signals, LoopbackResult* result)
+{
+    for (auto& signal : signals)
+    {
+        for (const auto& packet : signal.reader.readAll())
+        {
+            if (packet.getType() != PacketType::Data || result == nullptr)
+                continue;
+
+            const auto now = system_clock::now();
+            const DataPacketPtr dataPacket = packet;
+            const auto sampleCount = dataPacket.getSampleCount();
+            result->packetCount++;
+            result->sampleCount += sampleCount;
+            result->byteCount += dataPacket.getRawDataSize();
+
+            const auto domainPacket = dataPacket.getDomainPacket();
+            if (!domainPacket.assigned() || sampleCount == 0)
+                continue;
+
+            const Int lastTick = domainPacket.getLastValue();
+            const auto created = reader::toSysTime(lastTick, signal.epoch, signal.resolution);
+            result->latency.add(duration_cast<microseconds>(now - created).count());
+        }
+    }
+}
+
+bool runTransport(const Options& options, const Transport& transport, LoopbackResult& result)
+{
+    const auto server = Instance(options.modulePath);
+    const auto serverDevice = server.addDevice("daqref://device0");
+    serverDevice.setPropertyValue("NumberOfChannels", options.signalCount);
+    serverDevice.setPropertyValue("GlobalSampleRate", options.sampleRate);
+    serverDevice.setPropertyValue("AcquisitionLoopTime", options.loopTime);
+
+    for (const auto& serverType : transport.serverTypes)
+        server.addServer(serverType, nullptr);
+
+    {
+        const auto client = Instance(options.modulePath);
+
+        PropertyObjectPtr config;
+        if (!transport.primaryStreamingProtocol.empty())
+        {
+            config = client.getAvailableDeviceTypes().get("daq.opcua").createDefaultConfig();
+            config.setPropertyValue("AllowedStreamingProtocols", List<IString>("daq.ns", "daq.wss"));
+            config.setPropertyValue("PrimaryStreamingProtocol", transport.primaryStreamingProtocol);
+        }
+
+        const auto clientDevice = client.addDevice(transport.connectionString, config);
+        auto signals = subscribe(clientDevice);
+        if (signals.empty())
+        {
+            std::cerr << "No channel signals found on " << transport.connectionString << std::endl;
+            return false;
+        }
+
+        const auto pollInterval = milliseconds(options.pollInterval);
+        const auto warmupEnd = steady_clock::now() + duration<double>(options.warmup);
+        while (steady_clock::now() < warmupEnd)
+        {
+            poll(signals, nullptr);
+            std::this_thread::sleep_for(pollInterval);
+        }
+
+        result.transport = transport.name;
+        result.signalCount = signals.size();
+        result.sampleRate = options.sampleRate;
+
+        result.cpu.start();
+        const auto start = steady_clock::now();
+        const auto end = start + duration<double>(options.duration);
+        while (steady_clock::now() < end)
+        {
+            poll(signals, &result);
+            std::this_thread::sleep_for(pollInterval);
+        }
+        result.duration = steady_clock::now() - start;
+        result.cpu.stop();
+    }
+
+    // The client instance is destroyed before the server so that it disconnects cleanly
+    return true;
+}
+
+}
+
+int main(int argc, const char* argv[])
+{
+    Options options;
+    if (!parseOptions(argc, argv, options))
+    {
+        printUsage(std::cerr);
+        return 1;
+    }
+
+    int exitCode = 0;
+    for (const auto& name : options.transports)
+    {
+        const auto it = std::find_if(transports.begin(), transports.end(), [&name](const Transport& t) { return t.name == name; });
+        if (it == transports.end())
+        {
+            std::cerr << "Unknown transport " << name << std::endl;
+            exitCode = 1;
+            continue;
+        }
+
+        try
+        {
+            LoopbackResult result;
+            if (runTransport(options, *it, result))
+                printResult(std::cout, result);
+            else
+                exitCode = 1;
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "Transport " << name << " failed: " << e.what() << std::endl;
+            exitCode = 1;
+        }
+    }
+
+    return exitCode;
+}
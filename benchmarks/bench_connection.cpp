@@ -0,0 +1,201 @@
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/input_port_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/signal_factory.h>
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+
+using namespace daq;
+
+namespace
+{
+
+SignalConfigPtr createSignal(const ContextPtr& context)
+{
+    return SignalWithDescriptor(context, DataDescriptorBuilder().setSampleType(SampleType::Float64).build(), nullptr, "sig");
+}
+
+}
+
+// Every benchmark thread enqueues to and dequeues from the same connection, so the queue lock is shared by all of them
+static void BM_ConnectionEnqueueDequeue(benchmark::State& state)
+{
+    static ContextPtr context;
+    static SignalConfigPtr signal;
+    static InputPortConfigPtr port;
+    static ConnectionPtr connection;
+    static DataPacketPtr packet;
+
+    if (state.thread_index() == 0)
+    {
+        context = NullContext();
+        signal = createSignal(context);
+        port = InputPort(context, nullptr, "ip");
+        port.connect(signal);
+        connection = port.getConnection();
+        packet = DataPacket(signal.getDescriptor(), 1);
+    }
+
+    for (auto _ : state)
+    {
+        connection.enqueue(packet);
+        benchmark::DoNotOptimize(connection.dequeue());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        port.disconnect();
+        packet.release();
+        connection.release();
+        port.release();
+        signal.release();
+        context.release();
+    }
+}
+BENCHMARK(BM_ConnectionEnqueueDequeue)->ThreadRange(1, 8)->UseRealTime();
+
+// One consumer drains the connection while the benchmark threads produce into it
+static void BM_ConnectionProducerConsumer(benchmark::State& state)
+{
+    static ContextPtr context;
+    static SignalConfigPtr signal;
+    static InputPortConfigPtr port;
+    static ConnectionPtr connection;
+    static DataPacketPtr packet;
+    static std::atomic<bool> running;
+    static std::thread consumer;
+
+    if (state.thread_index() == 0)
+    {
+        context = NullContext();
+        signal = createSignal(context);
+        port = InputPort(context, nullptr, "ip");
+        // producers can outrun the consumer, the bounded queue keeps the memory use constant
+        port.setQueueOptions(1024, QueueOverflowPolicy::DropOldest);
+        port.connect(signal);
+        connection = port.getConnection();
+        packet = DataPacket(signal.getDescriptor(), 1);
+
+        running = true;
+        consumer = std::thread([]
+        {
+            while (running)
+            {
+                while (connection.dequeue().assigned())
+                {
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+
+    for (auto _ : state)
+        connection.enqueue(packet);
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        running = false;
+        consumer.join();
+
+        port.disconnect();
+        packet.release();
+        connection.release();
+        port.release();
+        signal.release();
+        context.release();
+    }
+}
+BENCHMARK(BM_ConnectionProducerConsumer)->ThreadRange(1, 4)->UseRealTime();
+
+// Sends packets to a signal with two readers while another thread optionally reads and changes the signal
+// attributes and connects and disconnects an input port, the traffic a UI causes during acquisition
+static void BM_SignalSendPacket(benchmark::State& state)
+{
+    const bool configurationTraffic = state.range(0) != 0;
+
+    const auto context = NullContext();
+    const auto signal = createSignal(context);
+    const auto packet = DataPacket(signal.getDescriptor(), 1);
+
+    const auto firstPort = InputPort(context, nullptr, "ip0");
+    const auto secondPort = InputPort(context, nullptr, "ip1");
+    firstPort.connect(signal);
+    secondPort.connect(signal);
+    const auto firstConnection = firstPort.getConnection();
+    const auto secondConnection = secondPort.getConnection();
+
+    std::atomic<bool> running{true};
+    std::thread configuration;
+    if (configurationTraffic)
+    {
+        configuration = std::thread([&running, &signal, &context]
+        {
+            const auto port = InputPort(context, nullptr, "ui");
+            while (running)
+            {
+                benchmark::DoNotOptimize(signal.getActive());
+                benchmark::DoNotOptimize(signal.getName());
+                benchmark::DoNotOptimize(signal.getDescriptor());
+                signal.setDescription("description");
+
+                port.connect(signal);
+                port.disconnect();
+            }
+        });
+    }
+
+    for (auto _ : state)
+    {
+        signal.sendPacket(packet);
+        firstConnection.dequeue();
+        secondConnection.dequeue();
+    }
+
+    running = false;
+    if (configuration.joinable())
+        configuration.join();
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SignalSendPacket)->ArgName("configurationTraffic")->Arg(0)->Arg(1)->UseRealTime();
+
+// Several acquisition threads send to the same signal
+static void BM_SignalSendPacketContention(benchmark::State& state)
+{
+    static ContextPtr context;
+    static SignalConfigPtr signal;
+    static InputPortConfigPtr port;
+    static DataPacketPtr packet;
+
+    if (state.thread_index() == 0)
+    {
+        context = NullContext();
+        signal = createSignal(context);
+        port = InputPort(context, nullptr, "ip");
+        // nobody reads the packets, the bounded queue keeps the memory use constant
+        port.setQueueOptions(64, QueueOverflowPolicy::DropOldest);
+        port.connect(signal);
+        packet = DataPacket(signal.getDescriptor(), 1);
+    }
+
+    for (auto _ : state)
+        signal.sendPacket(packet);
+
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0)
+    {
+        port.disconnect();
+        packet.release();
+        port.release();
+        signal.release();
+        context.release();
+    }
+}
+BENCHMARK(BM_SignalSendPacketContention)->ThreadRange(1, 8)->UseRealTime();
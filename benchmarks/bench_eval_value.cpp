@@ -0,0 +1,58 @@
+#include <coreobjects/eval_value_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coreobjects/property_object_factory.h>
+#include <benchmark/benchmark.h>
+
+using namespace daq;
+
+static void BM_EvalValueParse(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(EvalValue("($Gain * 2.5 + $Offset) / 3 > 10 && $Enabled"));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvalValueParse);
+
+static void BM_EvalValueConstant(benchmark::State& state)
+{
+    const auto eval = EvalValue("(1 + 2) * 3 - 4 / 2");
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(eval.getResult());
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvalValueConstant);
+
+// Property references are resolved on the owner on each evaluation
+static void BM_EvalValuePropertyReferences(benchmark::State& state)
+{
+    const auto propObj = PropertyObject();
+    propObj.addProperty(FloatProperty("Gain", 2.0));
+    propObj.addProperty(FloatProperty("Offset", 0.5));
+    propObj.addProperty(BoolProperty("Enabled", True));
+
+    const auto eval = EvalValue("($Gain * 2.5 + $Offset) / 3 > 10 && $Enabled").cloneWithOwner(propObj);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(eval.getResult());
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvalValuePropertyReferences);
+
+// A property whose default value is an expression is evaluated on every read
+static void BM_EvalValuePropertyRead(benchmark::State& state)
+{
+    const auto propObj = PropertyObject();
+    propObj.addProperty(IntProperty("Lhs", 1));
+    propObj.addProperty(IntProperty("Rhs", 2));
+    propObj.addProperty(IntProperty("Sum", EvalValue("$Lhs + $Rhs")));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(propObj.getPropertyValue("Sum"));
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_EvalValuePropertyRead);
@@ -0,0 +1,187 @@
+#include <packet_streaming/packet_compression.h>
+#include <packet_streaming/packet_streaming_client.h>
+#include <packet_streaming/packet_streaming_server.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace daq;
+using namespace daq::packet_streaming;
+
+namespace
+{
+
+constexpr SizeT PacketSize = 4096;
+
+// Slowly varying sensor data, the case the compression is meant for
+template <typename T>
+void fillSignal(T* data, SizeT count, SizeT firstSample = 0)
+{
+    for (SizeT i = 0; i < count; ++i)
+    {
+        const double value = 1000.0 * std::sin(static_cast<double>(firstSample + i) * 0.001);
+        data[i] = static_cast<T>(value);
+    }
+}
+
+// Copies the buffer like a transport would, so that the client owns the received memory
+PacketBufferPtr transmit(const PacketBufferPtr& packetBuffer)
+{
+    const auto headerSize = packetBuffer->packetHeader->size;
+    const auto payloadSize = packetBuffer->packetHeader->payloadSize;
+
+    auto header = static_cast<GenericPacketHeader*>(std::malloc(headerSize));
+    std::memcpy(header, packetBuffer->packetHeader, headerSize);
+
+    void* payload = nullptr;
+    if (payloadSize > 0)
+    {
+        payload = std::malloc(payloadSize);
+        std::memcpy(payload, packetBuffer->payload, payloadSize);
+    }
+
+    return std::make_shared<PacketBuffer>(header, payload, [header, payload]
+    {
+        std::free(header);
+        std::free(payload);
+    });
+}
+
+}
+
+template <typename T>
+static void BM_PacketCompression(benchmark::State& state)
+{
+    constexpr auto sampleType = SampleTypeFromType<T>::SampleType;
+
+    std::vector<T> src(PacketSize);
+    fillSignal(src.data(), PacketSize);
+    std::vector<uint8_t> compressed(PacketCompression::getMaxCompressedSize(PacketSize, sizeof(T)));
+
+    size_t compressedSize = 0;
+    for (auto _ : state)
+    {
+        compressedSize = PacketCompression::compress(sampleType, src.data(), PacketSize, compressed.data());
+        benchmark::DoNotOptimize(compressed.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(PacketSize * sizeof(T)));
+    state.counters["ratio"] = static_cast<double>(PacketSize * sizeof(T)) / static_cast<double>(compressedSize);
+}
+BENCHMARK_TEMPLATE(BM_PacketCompression, int16_t);
+BENCHMARK_TEMPLATE(BM_PacketCompression, int32_t);
+BENCHMARK_TEMPLATE(BM_PacketCompression, int64_t);
+BENCHMARK_TEMPLATE(BM_PacketCompression, float);
+BENCHMARK_TEMPLATE(BM_PacketCompression, double);
+
+template <typename T>
+static void BM_PacketDecompression(benchmark::State& state)
+{
+    constexpr auto sampleType = SampleTypeFromType<T>::SampleType;
+
+    std::vector<T> src(PacketSize);
+    fillSignal(src.data(), PacketSize);
+    std::vector<uint8_t> compressed(PacketCompression::getMaxCompressedSize(PacketSize, sizeof(T)));
+    const auto compressedSize = PacketCompression::compress(sampleType, src.data(), PacketSize, compressed.data());
+
+    std::vector<T> dst(PacketSize);
+    for (auto _ : state)
+    {
+        PacketCompression::decompress(sampleType, compressed.data(), compressedSize, dst.data(), PacketSize);
+        benchmark::DoNotOptimize(dst.data());
+    }
+
+    if (std::memcmp(src.data(), dst.data(), PacketSize * sizeof(T)) != 0)
+        state.SkipWithError("Decompressed data does not match the source");
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(PacketSize * sizeof(T)));
+    state.counters["ratio"] = static_cast<double>(PacketSize * sizeof(T)) / static_cast<double>(compressedSize);
+}
+BENCHMARK_TEMPLATE(BM_PacketDecompression, int16_t);
+BENCHMARK_TEMPLATE(BM_PacketDecompression, int32_t);
+BENCHMARK_TEMPLATE(BM_PacketDecompression, int64_t);
+BENCHMARK_TEMPLATE(BM_PacketDecompression, float);
+BENCHMARK_TEMPLATE(BM_PacketDecompression, double);
+
+// Encodes data packets on the server, transmits them and decodes them on the client
+template <typename T>
+static void BM_PacketStreamingRoundTrip(benchmark::State& state)
+{
+    const bool compression = state.range(0) != 0;
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleTypeFromType<T>::SampleType).build();
+
+    PacketStreamingServer server;
+    server.setCompressionEnabled(compression);
+    PacketStreamingClient client;
+
+    const auto transmitAll = [&server, &client]
+    {
+        size_t bytes = 0;
+        while (const auto packetBuffer = server.getNextPacketBuffer())
+        {
+            bytes += packetBuffer->packetHeader->size + packetBuffer->packetHeader->payloadSize;
+            client.addPacketBuffer(transmit(packetBuffer));
+        }
+        return bytes;
+    };
+
+    server.addDaqPacket(1, DataDescriptorChangedEventPacket(descriptor, nullptr));
+    transmitAll();
+    client.getNextDaqPacket();
+
+    SizeT firstSample = 0;
+    size_t transmittedBytes = 0;
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto packet = DataPacket(descriptor, PacketSize);
+        fillSignal(static_cast<T*>(packet.getRawData()), PacketSize, firstSample);
+        firstSample += PacketSize;
+        state.ResumeTiming();
+
+        server.addDaqPacket(1, std::move(packet));
+        server.checkAndSendReleasePacket(true);
+        transmittedBytes += transmitAll();
+
+        auto [signalId, clientPacket] = client.getNextDaqPacket();
+        if (!clientPacket.assigned())
+        {
+            state.SkipWithError("Client did not decode the data packet");
+            break;
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(PacketSize * sizeof(T)));
+    state.counters["transmittedBytesPerPacket"] =
+        benchmark::Counter(static_cast<double>(transmittedBytes), benchmark::Counter::kAvgIterations);
+}
+BENCHMARK_TEMPLATE(BM_PacketStreamingRoundTrip, int16_t)->ArgName("compression")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_PacketStreamingRoundTrip, int32_t)->ArgName("compression")->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_PacketStreamingRoundTrip, double)->ArgName("compression")->Arg(0)->Arg(1);
+
+static void BM_PacketStreamingEventPacket(benchmark::State& state)
+{
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).setName("value").build();
+    const auto eventPacket = DataDescriptorChangedEventPacket(valueDescriptor, nullptr);
+
+    PacketStreamingServer server;
+    PacketStreamingClient client;
+
+    for (auto _ : state)
+    {
+        server.addDaqPacket(1, eventPacket);
+        while (const auto packetBuffer = server.getNextPacketBuffer())
+            client.addPacketBuffer(transmit(packetBuffer));
+
+        auto [signalId, clientPacket] = client.getNextDaqPacket();
+        benchmark::DoNotOptimize(clientPacket);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PacketStreamingEventPacket);
@@ -0,0 +1,120 @@
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/malloc_allocator_factory.h>
+#include <opendaq/pool_allocator_factory.h>
+#include <coretypes/ratio_factory.h>
+#include <benchmark/benchmark.h>
+
+using namespace daq;
+
+namespace
+{
+
+enum class AllocatorKind : int64_t
+{
+    Default,
+    Malloc,
+    Pool
+};
+
+AllocatorPtr createAllocator(AllocatorKind kind)
+{
+    switch (kind)
+    {
+        case AllocatorKind::Malloc:
+            return MallocAllocator();
+        case AllocatorKind::Pool:
+            return PoolAllocator();
+        case AllocatorKind::Default:
+            break;
+    }
+
+    return nullptr;
+}
+
+const char* getAllocatorName(AllocatorKind kind)
+{
+    switch (kind)
+    {
+        case AllocatorKind::Malloc:
+            return "malloc";
+        case AllocatorKind::Pool:
+            return "pool";
+        case AllocatorKind::Default:
+            break;
+    }
+
+    return "default";
+}
+
+void applyAllocatorArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"allocator", "samples"});
+    for (const auto kind : {AllocatorKind::Default, AllocatorKind::Malloc, AllocatorKind::Pool})
+        for (const int64_t sampleCount : {1, 100, 10000})
+            bench->Args({static_cast<int64_t>(kind), sampleCount});
+}
+
+}
+
+static void BM_DataPacket(benchmark::State& state)
+{
+    const auto kind = static_cast<AllocatorKind>(state.range(0));
+    const auto sampleCount = static_cast<uint64_t>(state.range(1));
+    const auto allocator = createAllocator(kind);
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    for (auto _ : state)
+    {
+        auto packet = DataPacket(descriptor, sampleCount, nullptr, allocator);
+        benchmark::DoNotOptimize(packet.getRawData());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getAllocatorName(kind));
+}
+BENCHMARK(BM_DataPacket)->Apply(applyAllocatorArgs);
+
+static void BM_DataPacketWithDomain(benchmark::State& state)
+{
+    const auto kind = static_cast<AllocatorKind>(state.range(0));
+    const auto sampleCount = static_cast<uint64_t>(state.range(1));
+    const auto allocator = createAllocator(kind);
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    const auto domainDescriptor = DataDescriptorBuilder()
+                                      .setSampleType(SampleType::Int64)
+                                      .setRule(LinearDataRule(1, 0))
+                                      .setTickResolution(Ratio(1, 1000))
+                                      .setOrigin("1970-01-01T00:00:00Z")
+                                      .build();
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        auto domainPacket = DataPacket(domainDescriptor, sampleCount, offset, allocator);
+        auto packet = DataPacketWithDomain(domainPacket, valueDescriptor, sampleCount, nullptr, allocator);
+        benchmark::DoNotOptimize(packet.getRawData());
+        offset += static_cast<Int>(sampleCount);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetLabel(getAllocatorName(kind));
+}
+BENCHMARK(BM_DataPacketWithDomain)->Apply(applyAllocatorArgs);
+
+static void BM_DataPacketRawData(benchmark::State& state)
+{
+    const auto sampleCount = static_cast<uint64_t>(state.range(0));
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).setRule(LinearDataRule(1, 0)).build();
+
+    // Values of implicit packets are calculated on the first access
+    for (auto _ : state)
+    {
+        auto packet = DataPacket(descriptor, sampleCount, 0);
+        benchmark::DoNotOptimize(packet.getData());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DataPacketRawData)->ArgName("samples")->Arg(100)->Arg(10000);
@@ -0,0 +1,215 @@
+#include <opendaq/context_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/data_rule_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/reader_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <opendaq/signal_factory.h>
+#include <coretypes/ratio_factory.h>
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr SizeT PacketSize = 4096;
+constexpr SizeT BlockSize = 256;
+constexpr SizeT MultiReaderSignalCount = 4;
+
+template <typename TSource>
+DataDescriptorPtr createValueDescriptor()
+{
+    return DataDescriptorBuilder().setSampleType(SampleTypeFromType<TSource>::SampleType).build();
+}
+
+DataDescriptorPtr createDomainDescriptor()
+{
+    return DataDescriptorBuilder()
+        .setSampleType(SampleType::Int64)
+        .setRule(LinearDataRule(1, 0))
+        .setTickResolution(Ratio(1, 1000000))
+        .setOrigin("1970-01-01T00:00:00Z")
+        .build();
+}
+
+template <typename TSource>
+DataPacketPtr createValuePacket(const DataDescriptorPtr& descriptor, const DataPacketPtr& domainPacket = nullptr)
+{
+    auto packet = domainPacket.assigned() ? DataPacketWithDomain(domainPacket, descriptor, PacketSize) : DataPacket(descriptor, PacketSize);
+
+    auto data = static_cast<TSource*>(packet.getRawData());
+    for (SizeT i = 0; i < PacketSize; ++i)
+        data[i] = static_cast<TSource>(i % 100);
+
+    return packet;
+}
+
+// The first read of a new reader returns the descriptor changed event
+template <typename TReader>
+void consumeDescriptorEvent(const TReader& reader)
+{
+    SizeT count = 0;
+    reader.read(nullptr, &count);
+}
+
+}
+
+template <typename TSource, typename TRead>
+static void BM_StreamReader(benchmark::State& state)
+{
+    const auto context = NullContext();
+    const auto signal = SignalWithDescriptor(context, createValueDescriptor<TSource>(), nullptr, "sig");
+    const auto packet = createValuePacket<TSource>(signal.getDescriptor());
+
+    const auto reader = StreamReader<TRead, ClockTick>(signal, ReadTimeoutType::Any);
+    consumeDescriptorEvent(reader);
+
+    std::vector<TRead> values(PacketSize);
+    for (auto _ : state)
+    {
+        signal.sendPacket(packet);
+
+        SizeT count = PacketSize;
+        reader.read(values.data(), &count);
+        if (count != PacketSize)
+        {
+            state.SkipWithError("Reader returned fewer samples than were sent");
+            break;
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * PacketSize);
+    state.SetBytesProcessed(state.iterations() * PacketSize * sizeof(TSource));
+}
+BENCHMARK_TEMPLATE(BM_StreamReader, int16_t, double);
+BENCHMARK_TEMPLATE(BM_StreamReader, int16_t, float);
+BENCHMARK_TEMPLATE(BM_StreamReader, int32_t, double);
+BENCHMARK_TEMPLATE(BM_StreamReader, int64_t, int64_t);
+BENCHMARK_TEMPLATE(BM_StreamReader, float, double);
+BENCHMARK_TEMPLATE(BM_StreamReader, double, double);
+
+template <typename TSource, typename TRead>
+static void BM_BlockReader(benchmark::State& state)
+{
+    const auto context = NullContext();
+    const auto signal = SignalWithDescriptor(context, createValueDescriptor<TSource>(), nullptr, "sig");
+    const auto packet = createValuePacket<TSource>(signal.getDescriptor());
+
+    const auto reader = BlockReader<TRead, ClockTick>(signal, BlockSize);
+    consumeDescriptorEvent(reader);
+
+    constexpr SizeT blockCount = PacketSize / BlockSize;
+    std::vector<TRead> values(PacketSize);
+    for (auto _ : state)
+    {
+        signal.sendPacket(packet);
+
+        SizeT count = blockCount;
+        reader.read(values.data(), &count);
+        if (count != blockCount)
+        {
+            state.SkipWithError("Reader returned fewer blocks than were sent");
+            break;
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * PacketSize);
+    state.SetBytesProcessed(state.iterations() * PacketSize * sizeof(TSource));
+}
+BENCHMARK_TEMPLATE(BM_BlockReader, int16_t, double);
+BENCHMARK_TEMPLATE(BM_BlockReader, int32_t, double);
+BENCHMARK_TEMPLATE(BM_BlockReader, float, double);
+BENCHMARK_TEMPLATE(BM_BlockReader, double, double);
+
+template <typename TSource, typename TRead>
+static void BM_TailReader(benchmark::State& state)
+{
+    const auto context = NullContext();
+    const auto signal = SignalWithDescriptor(context, createValueDescriptor<TSource>(), nullptr, "sig");
+    const auto packet = createValuePacket<TSource>(signal.getDescriptor());
+
+    const auto reader = TailReader<TRead, ClockTick>(signal, PacketSize);
+    consumeDescriptorEvent(reader);
+
+    std::vector<TRead> values(PacketSize);
+    for (auto _ : state)
+    {
+        signal.sendPacket(packet);
+
+        SizeT count = PacketSize;
+        reader.read(values.data(), &count);
+        if (count != PacketSize)
+        {
+            state.SkipWithError("Reader returned fewer samples than were sent");
+            break;
+        }
+
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * PacketSize);
+    state.SetBytesProcessed(state.iterations() * PacketSize * sizeof(TSource));
+}
+BENCHMARK_TEMPLATE(BM_TailReader, int16_t, double);
+BENCHMARK_TEMPLATE(BM_TailReader, int32_t, double);
+BENCHMARK_TEMPLATE(BM_TailReader, float, double);
+BENCHMARK_TEMPLATE(BM_TailReader, double, double);
+
+// The packets of all signals share the domain, so the reader aligns them on every read. Creating the packets is part
+// of the measured loop, as the domain offset of each has to advance.
+template <typename TSource, typename TRead>
+static void BM_MultiReader(benchmark::State& state)
+{
+    const auto context = NullContext();
+    const auto domainSignal = SignalWithDescriptor(context, createDomainDescriptor(), nullptr, "time");
+
+    std::vector<SignalConfigPtr> signals;
+    auto signalList = List<ISignal>();
+    for (SizeT i = 0; i < MultiReaderSignalCount; ++i)
+    {
+        const auto signal = SignalWithDescriptor(context, createValueDescriptor<TSource>(), nullptr, "sig" + std::to_string(i));
+        signal.setDomainSignal(domainSignal);
+        signals.push_back(signal);
+        signalList.pushBack(signal);
+    }
+
+    const auto reader = MultiReader<TRead, ClockTick>(signalList, ReadTimeoutType::Any);
+    consumeDescriptorEvent(reader);
+
+    std::vector<std::vector<TRead>> values(MultiReaderSignalCount, std::vector<TRead>(PacketSize));
+    std::vector<void*> valuesPerSignal;
+    for (auto& signalValues : values)
+        valuesPerSignal.push_back(signalValues.data());
+
+    Int offset = 0;
+    for (auto _ : state)
+    {
+        const auto domainPacket = DataPacket(domainSignal.getDescriptor(), PacketSize, offset);
+        for (const auto& signal : signals)
+            signal.sendPacket(createValuePacket<TSource>(signal.getDescriptor(), domainPacket));
+        offset += static_cast<Int>(PacketSize);
+
+        SizeT count = PacketSize;
+        reader.read(valuesPerSignal.data(), &count);
+        if (count != PacketSize)
+        {
+            state.SkipWithError("Reader returned fewer samples than were sent");
+            break;
+        }
+
+        benchmark::DoNotOptimize(valuesPerSignal.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * PacketSize * MultiReaderSignalCount);
+    state.SetBytesProcessed(state.iterations() * PacketSize * MultiReaderSignalCount * sizeof(TSource));
+}
+BENCHMARK_TEMPLATE(BM_MultiReader, int16_t, double);
+BENCHMARK_TEMPLATE(BM_MultiReader, int32_t, double);
+BENCHMARK_TEMPLATE(BM_MultiReader, double, double);
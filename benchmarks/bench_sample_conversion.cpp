@@ -0,0 +1,87 @@
+#include <opendaq/sample_conversion.h>
+#include <benchmark/benchmark.h>
+#include <vector>
+
+using namespace daq;
+
+namespace
+{
+
+template <typename TFrom, typename TTo>
+void convertScalar(const TFrom* src, TTo* dst, SizeT count)
+{
+    for (SizeT i = 0; i < count; ++i)
+        dst[i] = (TTo) src[i];
+}
+
+template <typename TFrom>
+std::vector<TFrom> createSource(SizeT count)
+{
+    std::vector<TFrom> src(count);
+    for (SizeT i = 0; i < count; ++i)
+        src[i] = static_cast<TFrom>(i % 127);
+
+    return src;
+}
+
+void applySizeArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgName("samples")->Arg(64)->Arg(4096)->Arg(1 << 20);
+}
+
+}
+
+// The loop TypedReader used before the conversion kernels, as the baseline
+template <typename TFrom, typename TTo>
+static void BM_ConvertScalar(benchmark::State& state)
+{
+    const auto count = static_cast<SizeT>(state.range(0));
+    const auto src = createSource<TFrom>(count);
+    std::vector<TTo> dst(count);
+
+    for (auto _ : state)
+    {
+        convertScalar(src.data(), dst.data(), count);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(TFrom)));
+}
+
+template <typename TFrom, typename TTo>
+static void BM_ConvertKernel(benchmark::State& state)
+{
+    const auto count = static_cast<SizeT>(state.range(0));
+    const auto src = createSource<TFrom>(count);
+    std::vector<TTo> dst(count);
+
+    for (auto _ : state)
+    {
+        sample_conversion::convert(src.data(), dst.data(), count);
+        benchmark::DoNotOptimize(dst.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(TFrom)));
+    state.SetLabel(sample_conversion::getInstructionSet());
+}
+
+#define OPENDAQ_CONVERSION_BENCHMARK(TFrom, TTo)                            \
+    BENCHMARK_TEMPLATE(BM_ConvertScalar, TFrom, TTo)->Apply(applySizeArgs); \
+    BENCHMARK_TEMPLATE(BM_ConvertKernel, TFrom, TTo)->Apply(applySizeArgs)
+
+OPENDAQ_CONVERSION_BENCHMARK(int16_t, float);
+OPENDAQ_CONVERSION_BENCHMARK(int16_t, double);
+OPENDAQ_CONVERSION_BENCHMARK(uint16_t, double);
+OPENDAQ_CONVERSION_BENCHMARK(int32_t, float);
+OPENDAQ_CONVERSION_BENCHMARK(int32_t, double);
+OPENDAQ_CONVERSION_BENCHMARK(uint32_t, double);
+OPENDAQ_CONVERSION_BENCHMARK(int64_t, double);
+OPENDAQ_CONVERSION_BENCHMARK(float, double);
+OPENDAQ_CONVERSION_BENCHMARK(double, float);
+OPENDAQ_CONVERSION_BENCHMARK(double, int32_t);
+OPENDAQ_CONVERSION_BENCHMARK(int8_t, int32_t);
+OPENDAQ_CONVERSION_BENCHMARK(uint64_t, uint16_t);
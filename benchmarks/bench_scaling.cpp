@@ -0,0 +1,84 @@
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/scaling_factory.h>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+using namespace daq;
+
+namespace
+{
+
+constexpr SizeT PacketSize = 4096;
+
+enum class ScalingKind : int64_t
+{
+    Linear,
+    Polynomial,
+    UniformTable,
+    Table
+};
+
+ScalingPtr createScaling(ScalingKind kind)
+{
+    switch (kind)
+    {
+        case ScalingKind::Polynomial:
+            return PolynomialScaling(List<INumber>(0.1, 1.5, -0.02, 0.003, 1e-5, -1e-7), SampleType::Int16);
+        case ScalingKind::UniformTable:
+            return LookupTableScaling(List<INumber>(-32768, -16384, 0, 16384, 32767),
+                                      List<INumber>(-10.2, -5.0, 0.1, 5.2, 10.0),
+                                      SampleType::Int16);
+        case ScalingKind::Table:
+            return LookupTableScaling(List<INumber>(-32768, -1000, 0, 100, 20000, 32767),
+                                      List<INumber>(-10.2, -0.3, 0.1, 0.2, 6.0, 10.0),
+                                      SampleType::Int16);
+        case ScalingKind::Linear:
+            break;
+    }
+
+    return LinearScaling(0.0003, 0.1, SampleType::Int16);
+}
+
+const char* getScalingName(ScalingKind kind)
+{
+    switch (kind)
+    {
+        case ScalingKind::Polynomial:
+            return "polynomial";
+        case ScalingKind::UniformTable:
+            return "uniformTable";
+        case ScalingKind::Table:
+            return "table";
+        case ScalingKind::Linear:
+            break;
+    }
+
+    return "linear";
+}
+
+}
+
+// Scaled data is computed on the first getData call of each packet
+static void BM_PacketScaling(benchmark::State& state)
+{
+    const auto kind = static_cast<ScalingKind>(state.range(0));
+    const auto descriptor =
+        DataDescriptorBuilder().setSampleType(SampleType::Float64).setPostScaling(createScaling(kind)).build();
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto packet = DataPacket(descriptor, PacketSize);
+        auto raw = static_cast<int16_t*>(packet.getRawData());
+        for (SizeT i = 0; i < PacketSize; ++i)
+            raw[i] = static_cast<int16_t>(i * 16 - 32768);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(packet.getData());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(PacketSize));
+    state.SetLabel(getScalingName(kind));
+}
+BENCHMARK(BM_PacketScaling)->ArgName("scaling")->DenseRange(0, 3);
@@ -0,0 +1,90 @@
+#include <opendaq/component_deserialize_context_factory.h>
+#include <opendaq/component_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/folder_factory.h>
+#include <coreobjects/property_factory.h>
+#include <coretypes/json_deserializer_factory.h>
+#include <coretypes/json_serializer_factory.h>
+#include <benchmark/benchmark.h>
+#include <string>
+
+using namespace daq;
+
+namespace
+{
+
+// A tree shaped like a device: folders of channels, each with a handful of configuration properties
+FolderConfigPtr createDeviceTree(const ContextPtr& context, SizeT folderCount, SizeT componentsPerFolder)
+{
+    const auto root = Folder(context, nullptr, "dev");
+    root.setName("Device");
+    root.setDescription("Benchmark device");
+
+    for (SizeT i = 0; i < folderCount; ++i)
+    {
+        const auto folder = Folder(context, root, "ch" + std::to_string(i));
+        for (SizeT j = 0; j < componentsPerFolder; ++j)
+        {
+            const auto component = Component(context, folder, "comp" + std::to_string(j));
+            component.setDescription("Channel component");
+            component.addProperty(IntProperty("SampleRate", 1000));
+            component.addProperty(FloatProperty("Amplitude", 5.0));
+            component.addProperty(FloatProperty("Offset", 0.0));
+            component.addProperty(StringProperty("Unit", "V"));
+            component.addProperty(BoolProperty("Enabled", True));
+            component.setPropertyValue("SampleRate", static_cast<Int>(j));
+
+            folder.addItem(component);
+        }
+
+        root.addItem(folder);
+    }
+
+    return root;
+}
+
+void applyTreeArgs(benchmark::internal::Benchmark* bench)
+{
+    bench->ArgNames({"folders", "components"})->Args({4, 8})->Args({32, 32});
+}
+
+}
+
+static void BM_JsonSerializeTree(benchmark::State& state)
+{
+    const auto tree = createDeviceTree(NullContext(), state.range(0), state.range(1));
+
+    size_t outputSize = 0;
+    for (auto _ : state)
+    {
+        const auto serializer = JsonSerializer();
+        tree.serialize(serializer);
+        outputSize = serializer.getOutput().getLength();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(outputSize));
+}
+BENCHMARK(BM_JsonSerializeTree)->Apply(applyTreeArgs);
+
+static void BM_JsonDeserializeTree(benchmark::State& state)
+{
+    const auto context = NullContext();
+    const auto tree = createDeviceTree(context, state.range(0), state.range(1));
+
+    const auto serializer = JsonSerializer();
+    tree.serialize(serializer);
+    const auto json = serializer.getOutput();
+
+    const auto deserializer = JsonDeserializer();
+    for (auto _ : state)
+    {
+        const auto deserializeContext = ComponentDeserializeContext(context, nullptr, nullptr, "dev");
+        const FolderPtr folder = deserializer.deserialize(json, deserializeContext, nullptr);
+        benchmark::DoNotOptimize(folder.getObject());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(json.getLength()));
+}
+BENCHMARK(BM_JsonDeserializeTree)->Apply(applyTreeArgs);
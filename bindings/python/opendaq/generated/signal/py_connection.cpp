@@ -30,6 +30,12 @@
 
 PyDaqIntf<daq::IConnection, daq::IBaseObject> declareIConnection(pybind11::module_ m)
 {
+    py::enum_<daq::QueueOverflowPolicy>(m, "QueueOverflowPolicy")
+        .value("DropOldest", daq::QueueOverflowPolicy::DropOldest)
+        .value("DropNewest", daq::QueueOverflowPolicy::DropNewest)
+        .value("BlockProducer", daq::QueueOverflowPolicy::BlockProducer)
+        .value("Unbounded", daq::QueueOverflowPolicy::Unbounded);
+
     return wrapInterface<daq::IConnection, daq::IBaseObject>(m, "IConnection");
 }
 
@@ -106,4 +112,12 @@ void defineIConnection(pybind11::module_ m, PyDaqIntf<daq::IConnection, daq::IBa
             return objectPtr.getSamplesUntilNextDescriptor();
         },
         "Gets the number of same-type samples available in the queued packets. The returned value is up-to the next Sample-Descriptor-Changed packet if any.");
+    cls.def("enqueue_multiple",
+        [](daq::IConnection *object, daq::IList* packets)
+        {
+            const auto objectPtr = daq::ConnectionPtr::Borrow(object);
+            objectPtr.enqueueMultiple(packets);
+        },
+        py::arg("packets"),
+        "Places multiple packets at the back of the queue.");
 }
@@ -95,4 +95,12 @@ void defineIInputPortConfig(pybind11::module_ m, PyDaqIntf<daq::IInputPortConfig
             objectPtr.setRequiresSignal(requiresSignal);
         },
         "Sets requires signal flag of the input port.");
+    cls.def("set_queue_options",
+        [](daq::IInputPortConfig *object, const size_t capacity, daq::QueueOverflowPolicy overflowPolicy)
+        {
+            const auto objectPtr = daq::InputPortConfigPtr::Borrow(object);
+            objectPtr.setQueueOptions(capacity, overflowPolicy);
+        },
+        py::arg("capacity"), py::arg("overflow_policy"),
+        "Sets the queue used by connections that are created when a signal is connected to the input port.");
 }
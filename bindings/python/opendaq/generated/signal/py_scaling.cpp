@@ -32,7 +32,9 @@ PyDaqIntf<daq::IScaling, daq::IBaseObject> declareIScaling(pybind11::module_ m)
 {
     py::enum_<daq::ScalingType>(m, "ScalingType")
         .value("Other", daq::ScalingType::Other)
-        .value("Linear", daq::ScalingType::Linear);
+        .value("Linear", daq::ScalingType::Linear)
+        .value("Polynomial", daq::ScalingType::Polynomial)
+        .value("LookupTable", daq::ScalingType::LookupTable);
 
     return wrapInterface<daq::IScaling, daq::IBaseObject>(m, "IScaling");
 }
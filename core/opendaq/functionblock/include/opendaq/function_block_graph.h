@@ -0,0 +1,75 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/component.h>
+#include <opendaq/scheduler.h>
+#include <coretypes/listobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_function_blocks
+ * @addtogroup opendaq_function_block_graph Function block graph
+ * @{
+ */
+
+/*!
+ * @brief Processes the function blocks of a component tree as a dataflow graph.
+ *
+ * The graph contains every function block found under the root component, with an edge from the function
+ * block owning a signal to each function block whose input port is connected to that signal. Each call to
+ * `execute` runs one processing cycle on the scheduler: a function block is notified about its queued
+ * packets only after all function blocks feeding it were processed in the same cycle, while independent
+ * chains of function blocks are processed in parallel. Function blocks that are part of a feedback loop
+ * are processed one after another after the rest of the graph.
+ *
+ * The graph drives the input ports of its function blocks itself, so their notification method is set
+ * to `PacketReadyNotification::None` while they are part of the graph. Ports that leave the graph, or all
+ * of them when the graph is destroyed, are switched back to `PacketReadyNotification::Scheduler`.
+ *
+ * Connection changes on the known input ports are detected at the start of each cycle and only the edges
+ * of the graph are rebuilt. Adding or removing function blocks requires a call to `invalidate`.
+ */
+DECLARE_OPENDAQ_INTERFACE(IFunctionBlockGraph, IBaseObject)
+{
+    /*!
+     * @brief Runs one processing cycle of the graph and waits for it to complete.
+     */
+    virtual ErrCode INTERFACE_FUNC execute() = 0;
+
+    /*!
+     * @brief Requests the function blocks of the graph to be collected again at the start of the next cycle.
+     */
+    virtual ErrCode INTERFACE_FUNC invalidate() = 0;
+
+    // [elementType(functionBlocks, IFunctionBlock)]
+    /*!
+     * @brief Gets the function blocks of the graph in the order of their dependencies.
+     * @param[out] functionBlocks The function blocks, each listed after all function blocks feeding it.
+     */
+    virtual ErrCode INTERFACE_FUNC getFunctionBlocks(IList** functionBlocks) = 0;
+};
+/*!@}*/
+
+OPENDAQ_DECLARE_CLASS_FACTORY(
+    LIBRARY_FACTORY, FunctionBlockGraph,
+    IComponent*, root,
+    IScheduler*, scheduler
+)
+
+END_NAMESPACE_OPENDAQ
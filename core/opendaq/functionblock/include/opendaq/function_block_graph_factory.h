@@ -0,0 +1,42 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/function_block_graph_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_function_block_graph
+ * @addtogroup opendaq_function_block_graph_factories Factories
+ * @{
+ */
+
+/*!
+ * @brief Creates a dataflow graph of the function blocks found under a component.
+ * @param root The component whose function blocks are processed, usually a device or an instance.
+ * @param scheduler The scheduler that runs the processing cycles.
+ */
+inline FunctionBlockGraphPtr FunctionBlockGraph(const ComponentPtr& root, const SchedulerPtr& scheduler)
+{
+    FunctionBlockGraphPtr obj(FunctionBlockGraph_Create(root, scheduler));
+    return obj;
+}
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/function_block_graph.h>
+#include <opendaq/function_block_ptr.h>
+#include <opendaq/component_ptr.h>
+#include <opendaq/connection_ptr.h>
+#include <opendaq/input_port_config_ptr.h>
+#include <opendaq/logger_component_ptr.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/task_ptr.h>
+#include <coretypes/intfs.h>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+class FunctionBlockGraphImpl : public ImplementationOf<IFunctionBlockGraph>
+{
+public:
+    explicit FunctionBlockGraphImpl(const ComponentPtr& root, const SchedulerPtr& scheduler);
+    ~FunctionBlockGraphImpl() override;
+
+    ErrCode INTERFACE_FUNC execute() override;
+    ErrCode INTERFACE_FUNC invalidate() override;
+    ErrCode INTERFACE_FUNC getFunctionBlocks(IList** functionBlocks) override;
+
+private:
+    struct PortState
+    {
+        InputPortConfigPtr port;
+        // Compared with the current connection of the port to detect connection changes
+        ConnectionPtr connection;
+        // Restored when the graph gives the port back
+        PacketReadyNotification previousMethod;
+    };
+
+    struct Node
+    {
+        FunctionBlockPtr functionBlock;
+        std::vector<PortState> ports;
+        std::vector<std::size_t> predecessors;
+        TaskPtr task;
+    };
+
+    ComponentPtr root;
+    SchedulerPtr scheduler;
+    LoggerComponentPtr loggerComponent;
+
+    std::mutex sync;
+    bool nodesValid;
+    bool edgesValid;
+    // Sorted so that every node comes after its predecessors once the edges are built
+    std::vector<std::unique_ptr<Node>> nodes;
+    TaskPtr graph;
+
+    void collectFunctionBlocks();
+    void refreshPorts(Node& node);
+    bool refreshChangedPorts();
+    void buildEdges();
+    void buildTaskGraph();
+    void releasePort(const PortState& state);
+    void process(Node& node);
+};
+
+END_NAMESPACE_OPENDAQ
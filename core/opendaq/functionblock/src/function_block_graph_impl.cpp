@@ -0,0 +1,340 @@
+#include <opendaq/function_block_graph_impl.h>
+#include <opendaq/custom_log.h>
+#include <opendaq/folder_ptr.h>
+#include <opendaq/input_port_private_ptr.h>
+#include <opendaq/search_filter_factory.h>
+#include <opendaq/task_factory.h>
+#include <coretypes/validation.h>
+#include <algorithm>
+#include <unordered_map>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+FunctionBlockGraphImpl::FunctionBlockGraphImpl(const ComponentPtr& root, const SchedulerPtr& scheduler)
+    : root(root)
+    , scheduler(scheduler)
+    , nodesValid(false)
+    , edgesValid(false)
+{
+    if (!this->root.assigned())
+        throw ArgumentNullException("Root component must not be null");
+    if (!this->scheduler.assigned())
+        throw ArgumentNullException("Scheduler must not be null");
+
+    const auto logger = this->root.getContext().getLogger();
+    if (logger.assigned())
+        loggerComponent = logger.getOrAddComponent("FunctionBlockGraph");
+}
+
+FunctionBlockGraphImpl::~FunctionBlockGraphImpl()
+{
+    for (const auto& node : nodes)
+        for (const auto& state : node->ports)
+            releasePort(state);
+}
+
+ErrCode FunctionBlockGraphImpl::execute()
+{
+    return daqTry([this]
+    {
+        std::scoped_lock lock(sync);
+
+        if (!nodesValid)
+            collectFunctionBlocks();
+        else if (refreshChangedPorts())
+            edgesValid = false;
+
+        if (!edgesValid)
+        {
+            buildEdges();
+            buildTaskGraph();
+        }
+
+        if (!nodes.empty())
+            scheduler.scheduleGraph(graph).wait();
+    });
+}
+
+ErrCode FunctionBlockGraphImpl::invalidate()
+{
+    std::scoped_lock lock(sync);
+
+    nodesValid = false;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode FunctionBlockGraphImpl::getFunctionBlocks(IList** functionBlocks)
+{
+    OPENDAQ_PARAM_NOT_NULL(functionBlocks);
+
+    return daqTry([this, &functionBlocks]
+    {
+        std::scoped_lock lock(sync);
+
+        if (!nodesValid)
+            collectFunctionBlocks();
+        if (!edgesValid)
+        {
+            buildEdges();
+            buildTaskGraph();
+        }
+
+        auto list = List<IFunctionBlock>();
+        for (const auto& node : nodes)
+            list.pushBack(node->functionBlock);
+
+        *functionBlocks = list.detach();
+    });
+}
+
+void FunctionBlockGraphImpl::collectFunctionBlocks()
+{
+    std::vector<FunctionBlockPtr> functionBlocks;
+
+    const auto rootFunctionBlock = root.asPtrOrNull<IFunctionBlock>();
+    if (rootFunctionBlock.assigned())
+        functionBlocks.push_back(rootFunctionBlock);
+
+    const auto rootFolder = root.asPtrOrNull<IFolder>();
+    if (rootFolder.assigned())
+    {
+        for (const auto& item : rootFolder.getItems(search::Recursive(search::InterfaceId(IFunctionBlock::Id))))
+            functionBlocks.push_back(item.asPtr<IFunctionBlock>());
+    }
+
+    std::vector<std::unique_ptr<Node>> collected;
+    for (const auto& functionBlock : functionBlocks)
+    {
+        const auto existing = std::find_if(nodes.begin(), nodes.end(), [&functionBlock](const std::unique_ptr<Node>& node)
+        {
+            return node && node->functionBlock == functionBlock;
+        });
+
+        std::unique_ptr<Node> node;
+        if (existing != nodes.end())
+            node = std::move(*existing);
+        else
+            node = std::make_unique<Node>(Node{functionBlock, {}, {}, nullptr});
+
+        refreshPorts(*node);
+        collected.push_back(std::move(node));
+    }
+
+    // Function blocks that are no longer part of the tree give their ports back
+    for (const auto& node : nodes)
+    {
+        if (!node)
+            continue;
+        for (const auto& state : node->ports)
+            releasePort(state);
+    }
+
+    nodes = std::move(collected);
+    nodesValid = true;
+    edgesValid = false;
+}
+
+void FunctionBlockGraphImpl::refreshPorts(Node& node)
+{
+    std::vector<PortState> ports;
+    for (const auto& inputPort : node.functionBlock.getInputPorts(search::Any()))
+    {
+        const auto port = inputPort.asPtrOrNull<IInputPortConfig>();
+        if (!port.assigned())
+            continue;
+
+        // Ports adopted earlier already have their notifications disabled, so their original method is kept
+        const auto adopted = std::find_if(node.ports.begin(), node.ports.end(), [&port](const PortState& state)
+        {
+            return state.port == port;
+        });
+
+        PacketReadyNotification previousMethod;
+        if (adopted != node.ports.end())
+        {
+            previousMethod = adopted->previousMethod;
+        }
+        else
+        {
+            previousMethod = port.asPtr<IInputPortPrivate>(true).getNotificationMethod();
+            port.setNotificationMethod(PacketReadyNotification::None);
+        }
+
+        ports.push_back({port, port.getConnection(), previousMethod});
+    }
+
+    for (const auto& state : node.ports)
+    {
+        const auto kept = std::find_if(ports.begin(), ports.end(), [&state](const PortState& current)
+        {
+            return current.port == state.port;
+        });
+
+        if (kept == ports.end())
+            releasePort(state);
+    }
+
+    node.ports = std::move(ports);
+}
+
+bool FunctionBlockGraphImpl::refreshChangedPorts()
+{
+    bool changed = false;
+    for (const auto& node : nodes)
+    {
+        const bool nodeChanged = std::any_of(node->ports.begin(), node->ports.end(), [](const PortState& state)
+        {
+            return state.port.getConnection() != state.connection;
+        });
+
+        if (nodeChanged)
+        {
+            // A connection can add or remove ports of the function block, so its ports are collected again
+            refreshPorts(*node);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+void FunctionBlockGraphImpl::buildEdges()
+{
+    const std::size_t count = nodes.size();
+
+    std::unordered_map<IComponent*, std::size_t> indices;
+    for (std::size_t i = 0; i < count; ++i)
+        indices.emplace(nodes[i]->functionBlock.asPtr<IComponent>().getObject(), i);
+
+    // An edge leads from the function block owning a signal to each function block reading it
+    std::vector<std::vector<std::size_t>> predecessors(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (const auto& state : nodes[i]->ports)
+        {
+            if (!state.connection.assigned())
+                continue;
+
+            ComponentPtr owner = state.connection.getSignal();
+            while (owner.assigned())
+            {
+                const auto it = indices.find(owner.getObject());
+                if (it != indices.end())
+                {
+                    if (it->second != i)
+                        predecessors[i].push_back(it->second);
+                    break;
+                }
+
+                owner = owner.getParent();
+            }
+        }
+
+        std::sort(predecessors[i].begin(), predecessors[i].end());
+        predecessors[i].erase(std::unique(predecessors[i].begin(), predecessors[i].end()), predecessors[i].end());
+    }
+
+    std::vector<std::vector<std::size_t>> successors(count);
+    std::vector<std::size_t> pendingPredecessors(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        pendingPredecessors[i] = predecessors[i].size();
+        for (const auto predecessor : predecessors[i])
+            successors[predecessor].push_back(i);
+    }
+
+    std::vector<std::size_t> order;
+    order.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+        if (pendingPredecessors[i] == 0)
+            order.push_back(i);
+
+    for (std::size_t next = 0; next < order.size(); ++next)
+        for (const auto successor : successors[order[next]])
+            if (--pendingPredecessors[successor] == 0)
+                order.push_back(successor);
+
+    // Function blocks on a feedback loop never become ready; they run one after another after the rest of the graph
+    const std::size_t acyclicCount = order.size();
+    for (std::size_t i = 0; i < count; ++i)
+        if (pendingPredecessors[i] != 0)
+            order.push_back(i);
+
+    std::vector<std::size_t> positions(count);
+    for (std::size_t position = 0; position < count; ++position)
+        positions[order[position]] = position;
+
+    std::vector<std::unique_ptr<Node>> sorted;
+    sorted.reserve(count);
+    for (std::size_t position = 0; position < count; ++position)
+    {
+        const auto index = order[position];
+        auto& node = nodes[index];
+
+        node->predecessors.clear();
+        for (const auto predecessor : predecessors[index])
+            if (positions[predecessor] < position && (position < acyclicCount || positions[predecessor] < acyclicCount))
+                node->predecessors.push_back(positions[predecessor]);
+
+        if (position > acyclicCount)
+            node->predecessors.push_back(position - 1);
+
+        sorted.push_back(std::move(node));
+    }
+
+    nodes = std::move(sorted);
+    edgesValid = true;
+}
+
+void FunctionBlockGraphImpl::buildTaskGraph()
+{
+    graph = TaskGraph("FunctionBlockGraph");
+
+    // Nodes are sorted, so every predecessor is already part of the graph when its continuations are added
+    for (const auto& node : nodes)
+    {
+        Node* nodePtr = node.get();
+        node->task = Task([this, nodePtr] { process(*nodePtr); }, node->functionBlock.getLocalId());
+
+        if (node->predecessors.empty())
+            graph.then(node->task);
+        else
+            for (const auto predecessor : node->predecessors)
+                nodes[predecessor]->task.then(node->task);
+    }
+}
+
+void FunctionBlockGraphImpl::releasePort(const PortState& state)
+{
+    state.port->setNotificationMethod(state.previousMethod);
+}
+
+void FunctionBlockGraphImpl::process(Node& node)
+{
+    for (const auto& state : node.ports)
+    {
+        if (!state.connection.assigned() || state.connection.getPacketCount() == 0)
+            continue;
+
+        // Packets are handed to the listener registered on the port, which is a reader for ports read through one
+        const auto listener = state.port.asPtr<IInputPortPrivate>(true).getListener();
+        if (!listener.assigned())
+            continue;
+
+        const ErrCode errCode = listener->packetReceived(state.port);
+        if (OPENDAQ_FAILED(errCode))
+        {
+            daqClearErrorInfo();
+            if (loggerComponent.assigned())
+                LOG_W("Function block {} failed to process its input packets", node.functionBlock.getLocalId());
+        }
+    }
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY(
+    LIBRARY_FACTORY, FunctionBlockGraph,
+    IComponent*, root,
+    IScheduler*, scheduler
+)
+
+END_NAMESPACE_OPENDAQ
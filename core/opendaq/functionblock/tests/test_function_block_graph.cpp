@@ -0,0 +1,257 @@
+#include <opendaq/function_block_graph_factory.h>
+#include <opendaq/function_block_impl.h>
+#include <opendaq/function_block_type_factory.h>
+#include <opendaq/context_factory.h>
+#include <opendaq/folder_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <opendaq/logger_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/input_port_config_ptr.h>
+#include <opendaq/input_port_private_ptr.h>
+#include <opendaq/input_port_notifications.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using FunctionBlockGraphTest = testing::Test;
+
+class GraphFbImpl final : public daq::FunctionBlock
+{
+public:
+    GraphFbImpl(const daq::ContextPtr& ctx,
+                const daq::ComponentPtr& parent,
+                const daq::StringPtr& localId,
+                std::vector<std::string>* processed,
+                std::mutex* processedSync)
+        : daq::FunctionBlock(daq::FunctionBlockType("test_uid", "test_name", "test_description"), ctx, parent, localId)
+        , processed(processed)
+        , processedSync(processedSync)
+    {
+        signal = createAndAddSignal("sig");
+        createAndAddInputPort("ip", daq::PacketReadyNotification::Scheduler);
+    }
+
+    void onPacketReceived(const daq::InputPortPtr& port) override
+    {
+        const auto connection = port.getConnection();
+        for (auto packet = connection.dequeue(); packet.assigned(); packet = connection.dequeue())
+        {
+            {
+                std::scoped_lock lock(*processedSync);
+                processed->push_back(localId);
+            }
+
+            for (const auto& outputConnection : signal.getConnections())
+                outputConnection.enqueue(packet);
+        }
+    }
+
+private:
+    daq::SignalConfigPtr signal;
+    std::vector<std::string>* processed;
+    std::mutex* processedSync;
+};
+
+// Stands in for a reader that took over the input port of a function block
+class PortListenerImpl final : public daq::ImplementationOf<daq::IInputPortNotifications>
+{
+public:
+    explicit PortListenerImpl(std::vector<std::string>* processed)
+        : processed(processed)
+    {
+    }
+
+    daq::ErrCode INTERFACE_FUNC acceptsSignal(daq::IInputPort* port, daq::ISignal* signal, daq::Bool* accept) override
+    {
+        *accept = daq::True;
+        return OPENDAQ_SUCCESS;
+    }
+
+    daq::ErrCode INTERFACE_FUNC connected(daq::IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    daq::ErrCode INTERFACE_FUNC disconnected(daq::IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    daq::ErrCode INTERFACE_FUNC packetReceived(daq::IInputPort* port) override
+    {
+        const auto connection = daq::InputPortPtr::Borrow(port).getConnection();
+        for (auto packet = connection.dequeue(); packet.assigned(); packet = connection.dequeue())
+            processed->push_back("listener");
+        return OPENDAQ_SUCCESS;
+    }
+
+private:
+    std::vector<std::string>* processed;
+};
+
+class FunctionBlockGraphFixture : public FunctionBlockGraphTest
+{
+protected:
+    daq::FunctionBlockPtr addFunctionBlock(const std::string& localId)
+    {
+        const auto fb = daq::createWithImplementation<daq::IFunctionBlock, GraphFbImpl>(
+            daq::NullContext(), root, localId, &processed, &processedSync);
+        root.addItem(fb);
+        return fb;
+    }
+
+    static void connect(const daq::FunctionBlockPtr& producer, const daq::FunctionBlockPtr& consumer)
+    {
+        consumer.getInputPorts()[0].connect(producer.getSignals()[0]);
+    }
+
+    static daq::DataPacketPtr createPacket()
+    {
+        return daq::DataPacket(daq::DataDescriptorBuilder().setSampleType(daq::SampleType::Float64).build(), 1);
+    }
+
+    daq::FolderConfigPtr root = daq::Folder(daq::NullContext(), nullptr, "root");
+    daq::SchedulerPtr scheduler = daq::Scheduler(daq::Logger(), 2);
+    std::vector<std::string> processed;
+    std::mutex processedSync;
+};
+
+TEST_F(FunctionBlockGraphFixture, EmptyRoot)
+{
+    const auto graph = daq::FunctionBlockGraph(root, scheduler);
+
+    ASSERT_NO_THROW(graph.execute());
+    ASSERT_EQ(graph.getFunctionBlocks().getCount(), 0u);
+}
+
+TEST_F(FunctionBlockGraphFixture, TopologicalOrder)
+{
+    const auto c = addFunctionBlock("c");
+    const auto b = addFunctionBlock("b");
+    const auto d = addFunctionBlock("d");
+    const auto a = addFunctionBlock("a");
+    connect(a, b);
+    connect(b, c);
+
+    const auto graph = daq::FunctionBlockGraph(root, scheduler);
+    const auto functionBlocks = graph.getFunctionBlocks();
+    ASSERT_EQ(functionBlocks.getCount(), 4u);
+
+    std::vector<std::string> order;
+    for (const auto& fb : functionBlocks)
+        order.push_back(fb.getLocalId());
+
+    const auto position = [&order](const std::string& localId)
+    {
+        return std::find(order.begin(), order.end(), localId) - order.begin();
+    };
+
+    ASSERT_LT(position("a"), position("b"));
+    ASSERT_LT(position("b"), position("c"));
+}
+
+TEST_F(FunctionBlockGraphFixture, ExecuteInDependencyOrder)
+{
+    const auto c = addFunctionBlock("c");
+    const auto b = addFunctionBlock("b");
+    const auto a = addFunctionBlock("a");
+    connect(a, b);
+    connect(b, c);
+
+    const auto graph = daq::FunctionBlockGraph(root, scheduler);
+    ASSERT_NO_THROW(graph.execute());
+    ASSERT_TRUE(processed.empty());
+
+    b.getInputPorts()[0].getConnection().enqueue(createPacket());
+    ASSERT_NO_THROW(graph.execute());
+
+    ASSERT_EQ(processed, (std::vector<std::string>{"b", "c"}));
+}
+
+TEST_F(FunctionBlockGraphFixture, ConnectionChangeRebuildsEdges)
+{
+    const auto a = addFunctionBlock("a");
+    const auto b = addFunctionBlock("b");
+    const auto c = addFunctionBlock("c");
+    connect(c, b);
+
+    const auto graph = daq::FunctionBlockGraph(root, scheduler);
+    ASSERT_NO_THROW(graph.execute());
+
+    b.getInputPorts()[0].disconnect();
+    connect(a, b);
+    connect(b, c);
+
+    b.getInputPorts()[0].getConnection().enqueue(createPacket());
+    ASSERT_NO_THROW(graph.execute());
+
+    ASSERT_EQ(processed, (std::vector<std::string>{"b", "c"}));
+}
+
+TEST_F(FunctionBlockGraphFixture, InvalidateCollectsNewFunctionBlocks)
+{
+    const auto a = addFunctionBlock("a");
+
+    const auto graph = daq::FunctionBlockGraph(root, scheduler);
+    ASSERT_EQ(graph.getFunctionBlocks().getCount(), 1u);
+
+    const auto b = addFunctionBlock("b");
+    connect(a, b);
+    ASSERT_EQ(graph.getFunctionBlocks().getCount(), 1u);
+
+    graph.invalidate();
+    ASSERT_EQ(graph.getFunctionBlocks().getCount(), 2u);
+
+    a.getInputPorts()[0].connect(b.getSignals()[0]);
+    b.getInputPorts()[0].getConnection().enqueue(createPacket());
+    ASSERT_NO_THROW(graph.execute());
+
+    // a and b form a feedback loop, so they run one after another and the packet is not lost
+    ASSERT_FALSE(processed.empty());
+    ASSERT_EQ(processed.front(), "b");
+}
+
+TEST_F(FunctionBlockGraphFixture, DispatchToPortListener)
+{
+    const auto a = addFunctionBlock("a");
+    const auto b = addFunctionBlock("b");
+    connect(a, b);
+
+    const auto port = b.getInputPorts()[0].asPtr<daq::IInputPortConfig>();
+    const auto listener = daq::createWithImplementation<daq::IInputPortNotifications, PortListenerImpl>(&processed);
+    port.setListener(listener);
+
+    const auto graph = daq::FunctionBlockGraph(root, scheduler);
+    port.getConnection().enqueue(createPacket());
+    ASSERT_NO_THROW(graph.execute());
+
+    ASSERT_EQ(processed, (std::vector<std::string>{"listener"}));
+}
+
+TEST_F(FunctionBlockGraphFixture, RestoreNotificationMethod)
+{
+    const auto a = addFunctionBlock("a");
+    const auto port = a.getInputPorts()[0].asPtr<daq::IInputPortConfig>();
+    port.setNotificationMethod(daq::PacketReadyNotification::None);
+
+    {
+        const auto graph = daq::FunctionBlockGraph(root, scheduler);
+        ASSERT_NO_THROW(graph.execute());
+        ASSERT_NO_THROW(graph.invalidate());
+        ASSERT_NO_THROW(graph.execute());
+    }
+
+    ASSERT_EQ(port.asPtr<daq::IInputPortPrivate>().getNotificationMethod(), daq::PacketReadyNotification::None);
+
+    port.setNotificationMethod(daq::PacketReadyNotification::SameThread);
+    {
+        const auto graph = daq::FunctionBlockGraph(root, scheduler);
+        ASSERT_NO_THROW(graph.execute());
+        ASSERT_EQ(port.asPtr<daq::IInputPortPrivate>().getNotificationMethod(), daq::PacketReadyNotification::None);
+    }
+
+    ASSERT_EQ(port.asPtr<daq::IInputPortPrivate>().getNotificationMethod(), daq::PacketReadyNotification::SameThread);
+}
@@ -44,6 +44,7 @@ struct MockInputPort : daq::MockGenericComponent<MockInputPort, daq::IInputPortC
 
     MOCK_METHOD(daq::ErrCode, getCustomData, (daq::IBaseObject** customData), (override MOCK_CALL));
     MOCK_METHOD(daq::ErrCode, setCustomData, (daq::IBaseObject* customData), (override MOCK_CALL));
+    MOCK_METHOD(daq::ErrCode, setQueueOptions, (daq::SizeT capacity, daq::QueueOverflowPolicy overflowPolicy), (override MOCK_CALL));
 
     MockInputPort()
     {
@@ -149,11 +149,12 @@ void MockChannelImpl::addSineSignal()
 
     auto generatedSignal = std::make_shared<SignalGenerator>(signal);
 
-    generatedSignal->setFunction([this](uint64_t tick, void* sampleOut) {
-        auto outputRate = getOutputRate();
+    generatedSignal->setBlockFunction([this](uint64_t startTick, size_t sampleCount, void* samplesOut) {
         const double frequency = 10;
-        double* doubleOut = (double*) sampleOut;
-        *doubleOut = 1.0 * std::sin(tick * frequency / outputRate * M_PI * 2.0);
+        const double step = frequency / getOutputRate() * M_PI * 2.0;
+        double* doubleOut = (double*) samplesOut;
+        for (size_t i = 0; i < sampleCount; i++)
+            doubleOut[i] = 1.0 * std::sin((startTick + i) * step);
     });
 
     generatedSignals.push_back(generatedSignal);
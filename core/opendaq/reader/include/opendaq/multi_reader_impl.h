@@ -105,6 +105,7 @@ private:
 
     void readDomainStart();
     void sync();
+    void waitForSlowestSignal(Duration remainingTime);
 
     std::mutex mutex;
     bool invalid{false};
@@ -124,11 +125,16 @@ private:
 
     std::vector<SignalReader> signals;
     PropertyObjectPtr portBinder;
-    ProcedurePtr readCallback;
 
     LoggerComponentPtr loggerComponent;
 
     bool startOnFullUnitOfDomain;
+
+    // Guarded by notify.mutex as they are accessed from packetReceived while a timed read holds the mutex.
+    // When assigned, only packets on the awaited port wake up a waiting read.
+    NotifyInfo notify;
+    IBaseObject* awaitedPort{};
+    ProcedurePtr readCallback;
 };
 
 END_NAMESPACE_OPENDAQ
@@ -476,20 +476,6 @@ protected:
         return true;
     }
 
-    void* getValuePacketData(const DataPacketPtr& packet) const
-    {
-        switch (readMode)
-        {
-            case ReadMode::Unscaled:
-            case ReadMode::RawValue:
-                return packet.getRawData();
-            case ReadMode::Scaled:
-                return packet.getData();
-        }
-
-        throw InvalidOperationException("Unknown Reader read-mode of {}", static_cast<std::underlying_type_t<ReadMode>>(readMode));
-    }
-
     bool invalid{};
     std::mutex mutex;
     ReadMode readMode;
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+#include <coretypes/common.h>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace sample_conversion
+{
+    // Vectorized conversion kernels for the read type pairs of the numeric sample types. The implementation is
+    // selected on first use: AVX2 or SSE2 on x86-64, NEON on AArch64, a scalar loop otherwise. The results are
+    // identical to a scalar `static_cast` of each value.
+    void convertValues(const int8_t* src, float* dst, SizeT count);
+    void convertValues(const int8_t* src, double* dst, SizeT count);
+    void convertValues(const uint8_t* src, float* dst, SizeT count);
+    void convertValues(const uint8_t* src, double* dst, SizeT count);
+    void convertValues(const int16_t* src, float* dst, SizeT count);
+    void convertValues(const int16_t* src, double* dst, SizeT count);
+    void convertValues(const uint16_t* src, float* dst, SizeT count);
+    void convertValues(const uint16_t* src, double* dst, SizeT count);
+    void convertValues(const int32_t* src, float* dst, SizeT count);
+    void convertValues(const int32_t* src, double* dst, SizeT count);
+    void convertValues(const uint32_t* src, float* dst, SizeT count);
+    void convertValues(const uint32_t* src, double* dst, SizeT count);
+    void convertValues(const int64_t* src, double* dst, SizeT count);
+    void convertValues(const uint64_t* src, double* dst, SizeT count);
+    void convertValues(const float* src, double* dst, SizeT count);
+    void convertValues(const double* src, float* dst, SizeT count);
+    void convertValues(const float* src, int32_t* dst, SizeT count);
+    void convertValues(const double* src, int32_t* dst, SizeT count);
+
+    // Integer conversions only depend on the widths of the types and on the signedness of the source, so
+    // `convert` maps every integer pair onto one of these: narrowing keeps the low-order bits, widening
+    // sign-extends signed and zero-extends unsigned sources.
+    void convertValues(const uint16_t* src, uint8_t* dst, SizeT count);
+    void convertValues(const uint32_t* src, uint8_t* dst, SizeT count);
+    void convertValues(const uint32_t* src, uint16_t* dst, SizeT count);
+    void convertValues(const uint64_t* src, uint8_t* dst, SizeT count);
+    void convertValues(const uint64_t* src, uint16_t* dst, SizeT count);
+    void convertValues(const uint64_t* src, uint32_t* dst, SizeT count);
+    void convertValues(const int8_t* src, int16_t* dst, SizeT count);
+    void convertValues(const int8_t* src, int32_t* dst, SizeT count);
+    void convertValues(const int8_t* src, int64_t* dst, SizeT count);
+    void convertValues(const int16_t* src, int32_t* dst, SizeT count);
+    void convertValues(const int16_t* src, int64_t* dst, SizeT count);
+    void convertValues(const int32_t* src, int64_t* dst, SizeT count);
+    void convertValues(const uint8_t* src, uint16_t* dst, SizeT count);
+    void convertValues(const uint8_t* src, uint32_t* dst, SizeT count);
+    void convertValues(const uint8_t* src, uint64_t* dst, SizeT count);
+    void convertValues(const uint16_t* src, uint32_t* dst, SizeT count);
+    void convertValues(const uint16_t* src, uint64_t* dst, SizeT count);
+    void convertValues(const uint32_t* src, uint64_t* dst, SizeT count);
+
+    // Name of the instruction set used by the conversion kernels, e.g. "AVX2"
+    const char* getInstructionSet();
+
+    template <typename TFrom, typename TTo, typename = void>
+    struct HasConversionKernel : std::false_type
+    {
+    };
+
+    template <typename TFrom, typename TTo>
+    struct HasConversionKernel<TFrom,
+                               TTo,
+                               std::void_t<decltype(convertValues(std::declval<const TFrom*>(), std::declval<TTo*>(), SizeT()))>>
+        : std::true_type
+    {
+    };
+
+    template <typename T>
+    constexpr bool IsIntegerSample = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+    // 64-bit integers to float, and floating point to integers other than int32 have no exact vector
+    // equivalent on the supported instruction sets and use the scalar loop.
+    template <typename TFrom, typename TTo>
+    void convert(const TFrom* src, TTo* dst, SizeT count)
+    {
+        if constexpr (IsIntegerSample<TFrom> && IsIntegerSample<TTo> && sizeof(TFrom) == sizeof(TTo))
+        {
+            std::memcpy(dst, src, count * sizeof(TTo));
+        }
+        else if constexpr (IsIntegerSample<TFrom> && IsIntegerSample<TTo> && sizeof(TFrom) > sizeof(TTo))
+        {
+            using TUnsignedFrom = std::make_unsigned_t<TFrom>;
+            using TUnsignedTo = std::make_unsigned_t<TTo>;
+            convertValues(reinterpret_cast<const TUnsignedFrom*>(src), reinterpret_cast<TUnsignedTo*>(dst), count);
+        }
+        else if constexpr (IsIntegerSample<TFrom> && IsIntegerSample<TTo>)
+        {
+            if constexpr (std::is_signed_v<TFrom>)
+                convertValues(src, reinterpret_cast<std::make_signed_t<TTo>*>(dst), count);
+            else
+                convertValues(src, reinterpret_cast<std::make_unsigned_t<TTo>*>(dst), count);
+        }
+        else if constexpr (HasConversionKernel<TFrom, TTo>::value)
+        {
+            convertValues(src, dst, count);
+        }
+        else
+        {
+            for (SizeT i = 0; i < count; ++i)
+                dst[i] = (TTo) src[i];
+        }
+    }
+
+    // Applies linear scaling and converts the result to the read type in a single pass. Each value is computed
+    // in `TScaled` exactly as the post-scaling of a data packet does, so the result is identical to scaling
+    // the whole packet into a `TScaled` buffer and converting that buffer.
+    template <typename TFrom, typename TScaled, typename TTo>
+    void scaleLinear(const TFrom* src, TTo* dst, SizeT count, TScaled scale, TScaled offset)
+    {
+        for (SizeT i = 0; i < count; ++i)
+            dst[i] = (TTo) (scale * static_cast<TScaled>(src[i]) + offset);
+    }
+}
+
+END_NAMESPACE_OPENDAQ
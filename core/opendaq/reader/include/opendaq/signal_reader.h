@@ -78,7 +78,6 @@ struct SignalReader
     ErrCode readPacketData();
     ErrCode handlePacket(const PacketPtr& packet, bool& firstData);
 
-    void* getValuePacketData(const DataPacketPtr& packet) const;
 
     LoggerComponentPtr loggerComponent;
 
@@ -17,8 +17,11 @@
 #pragma once
 #include <opendaq/sample_type_traits.h>
 #include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/data_packet_ptr.h>
+#include <opendaq/data_rule_ptr.h>
 #include <opendaq/reader_domain_info.h>
 #include <opendaq/sample_reader.h>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -31,9 +34,25 @@ public:
     virtual ~Reader() = default;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) = 0;
-    virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
+
+    // Reads the values of a data packet in the given read mode: the raw data in the `RawValue` and `Unscaled`
+    // modes and the post-scaled data in the `Scaled` mode.
+    virtual ErrCode readPacketValues(const DataPacketPtr& packet, ReadMode mode, SizeT offset, void** outputBuffer, SizeT count);
+
+    // Reads the values of a domain packet. Values of linear-rule domain packets are computed directly into
+    // the output buffer instead of being read from the packet's materialized data.
+    virtual ErrCode readPacketDomain(const DataPacketPtr& domainPacket, SizeT offset, void** outputBuffer, SizeT count);
+
+    virtual std::unique_ptr<Comparable> readStart(const DataPacketPtr& domainPacket, SizeT offset, const ReaderDomainInfo& domainInfo) = 0;
     
     virtual SizeT getOffsetTo(const ReaderDomainInfo& domainInfo, const Comparable& start, void* inputBuffer, SizeT size) = 0;
+    // Same as getOffsetTo but computes the position from the linear rule of an implicit domain packet
+    // instead of scanning its materialized values
+    virtual SizeT getOffsetToLinear(const ReaderDomainInfo& domainInfo,
+                                    const Comparable& start,
+                                    const NumberPtr& packetOffset,
+                                    const DataRulePtr& rule,
+                                    SizeT size) = 0;
     virtual bool handleDescriptorChanged(DataDescriptorPtr& descriptor, ReadMode mode) = 0;
 
     [[nodiscard]] virtual bool isUndefined() const noexcept;
@@ -61,7 +80,7 @@ public:
         return OPENDAQ_ERR_INVALIDSTATE;
     }
 
-    virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override
+    virtual std::unique_ptr<Comparable> readStart(const DataPacketPtr& domainPacket, SizeT offset, const ReaderDomainInfo& domainInfo) override
     {
         throw InvalidStateException();
     }
@@ -71,6 +90,15 @@ public:
         throw InvalidStateException();
     }
 
+    SizeT getOffsetToLinear(const ReaderDomainInfo& domainInfo,
+                            const Comparable& start,
+                            const NumberPtr& packetOffset,
+                            const DataRulePtr& rule,
+                            SizeT size) override
+    {
+        throw InvalidStateException();
+    }
+
     virtual bool handleDescriptorChanged(DataDescriptorPtr& descriptor, ReadMode mode) override
     {
         return false;
@@ -96,9 +124,16 @@ public:
     using Reader::Reader;
 
     virtual ErrCode readData(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT count) override;
-    virtual std::unique_ptr<Comparable> readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo) override;
+    virtual ErrCode readPacketValues(const DataPacketPtr& packet, ReadMode mode, SizeT offset, void** outputBuffer, SizeT count) override;
+    virtual ErrCode readPacketDomain(const DataPacketPtr& domainPacket, SizeT offset, void** outputBuffer, SizeT count) override;
+    virtual std::unique_ptr<Comparable> readStart(const DataPacketPtr& domainPacket, SizeT offset, const ReaderDomainInfo& domainInfo) override;
 
     virtual SizeT getOffsetTo(const ReaderDomainInfo& domainInfo, const Comparable& start, void* inputBuffer, SizeT size) override;
+    virtual SizeT getOffsetToLinear(const ReaderDomainInfo& domainInfo,
+                                    const Comparable& start,
+                                    const NumberPtr& packetOffset,
+                                    const DataRulePtr& rule,
+                                    SizeT size) override;
 
     virtual bool handleDescriptorChanged(DataDescriptorPtr& descriptor, ReadMode mode) override;
 
@@ -107,12 +142,41 @@ private:
     template <typename TDataType>
     ErrCode readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const;
 
+    template <typename TRawType>
+    ErrCode readScaledValues(void* rawBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const;
+
+    template <typename TRawType, typename TScaledType>
+    ErrCode readScaledValues(void* rawBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const;
+
+    template <typename TDataType>
+    ErrCode readLinearDomain(const DataPacketPtr& domainPacket, SizeT offset, void** outputBuffer, SizeT toRead);
+
     template <typename TDataType>
     SizeT getOffsetToData(const ReaderDomainInfo& domainInfo, const Comparable& start, void* inputBuffer, SizeT size) const;
 
+    template <typename TDataType>
+    SizeT getOffsetToLinearData(const ReaderDomainInfo& domainInfo,
+                                const Comparable& start,
+                                const NumberPtr& packetOffset,
+                                const DataRulePtr& rule,
+                                SizeT size) const;
+
     SizeT valuesPerSample{1};
 
     SizeT rawSampleSize{0};
+
+    // Set when the descriptor has linear post-scaling and the values are read in the `Scaled` mode. The raw
+    // values are then scaled and converted to the read type in one pass, without the packet's scaled buffer.
+    bool fusedScaling{false};
+    SampleType scalingInputType{SampleType::Undefined};
+    ScaledSampleType scalingOutputType{ScaledSampleType::Invalid};
+    Float scalingScale{1.0};
+    Float scalingOffset{0.0};
+
+    // Set when the descriptor has a linear rule and no post-scaling, so that domain values can be computed
+    // from the rule. The buffer holds the computed values passed to a transform function.
+    bool linearDomain{false};
+    std::vector<uint8_t> linearDomainBuffer;
 };
 
 std::unique_ptr<Reader> createReaderForType(SampleType readType, const FunctionPtr& transformFunction);
@@ -131,7 +131,7 @@ ErrCode BlockReaderImpl::readPacketData()
     auto remainingSampleCount = info.dataPacket.getSampleCount() - info.prevSampleIndex;
     SizeT toRead = std::min(remainingSampleCount, blockSize);
 
-    ErrCode errCode = valueReader->readData(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead);
+    ErrCode errCode = valueReader->readPacketValues(info.dataPacket, readMode, info.prevSampleIndex, &info.values, toRead);
     if (OPENDAQ_FAILED(errCode))
     {
         return errCode;
@@ -146,14 +146,14 @@ ErrCode BlockReaderImpl::readPacketData()
         }
 
         auto domainPacket = dataPacket.getDomainPacket();
-        errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+        errCode = domainReader->readPacketDomain(domainPacket, info.prevSampleIndex, &info.domainValues, toRead);
         if (errCode == OPENDAQ_ERR_INVALIDSTATE)
         {
             if (!trySetDomainSampleType(domainPacket))
             {
                 return errCode;
             }
-            errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+            errCode = domainReader->readPacketDomain(domainPacket, info.prevSampleIndex, &info.domainValues, toRead);
         }
 
         if (OPENDAQ_FAILED(errCode))
@@ -8,7 +8,6 @@
 #include <coreobjects/ownable_ptr.h>
 
 #include <fmt/ostream.h>
-#include <thread>
 
 using namespace std::chrono;
 
@@ -330,7 +329,7 @@ ErrCode MultiReaderImpl::setOnDescriptorChanged(IFunction* callback)
 
 ErrCode MultiReaderImpl::setOnDataAvailable(IProcedure* callback)
 {
-    std::scoped_lock lock(mutex);
+    std::scoped_lock lock(mutex, notify.mutex);
 
     readCallback = callback;
     return OPENDAQ_SUCCESS;
@@ -594,8 +593,16 @@ ErrCode MultiReaderImpl::readPackets()
                                            ? 1ms
                                            : timeout;
 
-    while (remainingSamplesToRead > 0 && remainingTime >= 1ms)
+    // The whole timeout is used, a remainder below 1 ms is waited for as well instead of being dropped
+    while (remainingSamplesToRead > 0 && remainingTime > ReadInfo::Duration::zero())
     {
+        // Cleared before the signals are examined, so a packet arriving while they are read and synchronized
+        // is not lost and ends the wait of this iteration right away
+        {
+            std::scoped_lock notifyLock(notify.mutex);
+            notify.packetReady = false;
+        }
+
         errCode = readUntilFirstDataPacket();
         if (OPENDAQ_FAILED(errCode))
         {
@@ -613,7 +620,7 @@ ErrCode MultiReaderImpl::readPackets()
         if (timeout.count() != 0)
         {
             remainingTime = timeout - durationFromStart();
-            if (remainingTime < milliseconds(1))
+            if (remainingTime <= ReadInfo::Duration::zero())
             {
                 LOGP_T("Time exceeded when reading non-data packets")
                 break;
@@ -660,7 +667,8 @@ ErrCode MultiReaderImpl::readPackets()
                 duration_cast<milliseconds>(remainingTime).count()
             );
 
-            std::this_thread::sleep_for(1ms);
+            if (remainingSamplesToRead > 0 && remainingTime > ReadInfo::Duration::zero())
+                waitForSlowestSignal(remainingTime);
         }
         else if (min == 0)
         {
@@ -749,16 +757,55 @@ ErrCode MultiReaderImpl::disconnected(IInputPort* port)
     return OPENDAQ_SUCCESS;
 }
 
+void MultiReaderImpl::waitForSlowestSignal(Duration remainingTime)
+{
+    std::unique_lock notifyLock(notify.mutex);
+
+    // Nothing more can be read until the signal with the fewest samples receives new data
+    const auto slowest = std::min_element(signals.begin(), signals.end(), [](const SignalReader& lhs, const SignalReader& rhs)
+    {
+        return lhs.getAvailable() < rhs.getAvailable();
+    });
+
+    if (slowest == signals.end())
+        return;
+
+    const SizeT available = slowest->getAvailable();
+
+    // If every signal has data but they are still synchronizing, any new packet might complete it
+    awaitedPort = nullptr;
+    if (available == 0)
+        slowest->port->borrowInterface(IBaseObject::Id, reinterpret_cast<void**>(&awaitedPort));
+
+    notify.condition.wait_for(notifyLock, remainingTime, [&]
+    {
+        return notify.packetReady || slowest->getAvailable() != available;
+    });
+
+    awaitedPort = nullptr;
+}
+
 ErrCode MultiReaderImpl::packetReceived(IInputPort* inputPort)
 {
+    OPENDAQ_PARAM_NOT_NULL(inputPort);
+
     ProcedurePtr callback;
 
+    // Must not take the reader mutex here as a timed read holds it while waiting for this notification
     {
-        std::scoped_lock lock(mutex);
+        std::scoped_lock notifyLock(notify.mutex);
+
+        IBaseObject* port{};
+        inputPort->borrowInterface(IBaseObject::Id, reinterpret_cast<void**>(&port));
+        if (awaitedPort == nullptr || awaitedPort == port)
+            notify.packetReady = true;
+
         callback = readCallback;
-        if (!callback.assigned())
-            return OPENDAQ_SUCCESS;
     }
+    notify.condition.notify_one();
+
+    if (!callback.assigned())
+        return OPENDAQ_SUCCESS;
 
     SizeT count;
     getAvailableCount(&count);
@@ -0,0 +1,936 @@
+#include <opendaq/sample_conversion.h>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+    #define OPENDAQ_SAMPLE_CONVERSION_X86
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define OPENDAQ_TARGET_AVX2
+    #else
+        #define OPENDAQ_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define OPENDAQ_SAMPLE_CONVERSION_NEON
+    #include <arm_neon.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace sample_conversion
+{
+
+namespace
+{
+
+template <typename TFrom, typename TTo>
+void convertScalar(const TFrom* src, TTo* dst, SizeT count)
+{
+    for (SizeT i = 0; i < count; ++i)
+        dst[i] = static_cast<TTo>(src[i]);
+}
+
+template <typename TFrom, typename TTo>
+using ConvertFunction = void (*)(const TFrom*, TTo*, SizeT);
+
+template <SizeT Size, bool Signed>
+struct IntegerOfSize;
+
+template <> struct IntegerOfSize<1, true> { using Type = int8_t; };
+template <> struct IntegerOfSize<2, true> { using Type = int16_t; };
+template <> struct IntegerOfSize<4, true> { using Type = int32_t; };
+template <> struct IntegerOfSize<8, true> { using Type = int64_t; };
+template <> struct IntegerOfSize<1, false> { using Type = uint8_t; };
+template <> struct IntegerOfSize<2, false> { using Type = uint16_t; };
+template <> struct IntegerOfSize<4, false> { using Type = uint32_t; };
+template <> struct IntegerOfSize<8, false> { using Type = uint64_t; };
+
+// integer type twice as wide as T with the same signedness, used to widen in steps
+template <typename T>
+using WiderInteger = typename IntegerOfSize<sizeof(T) * 2, std::is_signed_v<T>>::Type;
+
+// unsigned integer type twice as wide as T, used to narrow in steps
+template <typename T>
+using WiderUnsigned = typename IntegerOfSize<sizeof(T) * 2, false>::Type;
+
+#if defined(OPENDAQ_SAMPLE_CONVERSION_X86)
+
+bool hasAvx2()
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+        return false;
+
+    __cpuid(info, 1);
+    const bool osXSave = info[2] & (1 << 27);
+    const bool avx = info[2] & (1 << 28);
+    if (!osXSave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+
+    __cpuidex(info, 7, 0);
+    return info[1] & (1 << 5);
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// SSE2 is part of the x86-64 baseline
+
+__m128i loadInt8AsInt32Sse2(const int8_t* src)
+{
+    int32_t packed;
+    std::memcpy(&packed, src, sizeof(packed));
+    const __m128i bytes = _mm_cvtsi32_si128(packed);
+    const __m128i words = _mm_unpacklo_epi8(bytes, bytes);
+    return _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 24);
+}
+
+__m128i loadUInt8AsInt32Sse2(const uint8_t* src)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int32_t packed;
+    std::memcpy(&packed, src, sizeof(packed));
+    const __m128i bytes = _mm_cvtsi32_si128(packed);
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero);
+}
+
+__m128i loadInt16AsInt32Sse2(const int16_t* src)
+{
+    const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    return _mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16);
+}
+
+__m128i loadUInt16AsInt32Sse2(const uint16_t* src)
+{
+    const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    return _mm_unpacklo_epi16(words, _mm_setzero_si128());
+}
+
+__m128i loadInt32Sse2(const int32_t* src)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+}
+
+// converts 4 values per iteration through a 32-bit integer vector
+template <typename TFrom, __m128i (*Load)(const TFrom*)>
+void convertToFloatSse2(const TFrom* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm_cvtepi32_ps(Load(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, __m128i (*Load)(const TFrom*)>
+void convertToDoubleSse2(const TFrom* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i values = Load(src + i);
+        _mm_storeu_pd(dst + i, _mm_cvtepi32_pd(values));
+        _mm_storeu_pd(dst + i + 2, _mm_cvtepi32_pd(_mm_shuffle_epi32(values, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertFloatToDoubleSse2(const float* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 values = _mm_loadu_ps(src + i);
+        _mm_storeu_pd(dst + i, _mm_cvtps_pd(values));
+        _mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(values, values)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertDoubleToFloatSse2(const double* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 low = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        const __m128 high = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_ps(dst + i, _mm_movelh_ps(low, high));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+__m128d convertUInt32LowToDoubleSse2(__m128i values)
+{
+    // offset into the int32 range, convert and add the offset back; every step is exact
+    const __m128i offset = _mm_set1_epi32(INT32_MIN);
+    return _mm_add_pd(_mm_cvtepi32_pd(_mm_xor_si128(values, offset)), _mm_set1_pd(2147483648.0));
+}
+
+void convertUInt32ToFloatSse2(const uint32_t* src, float* dst, SizeT count)
+{
+    // both 16-bit halves and the scaled upper half are exact, so the sum is rounded once like the scalar cast
+    const __m128i lowMask = _mm_set1_epi32(0xFFFF);
+    const __m128 highScale = _mm_set1_ps(65536.0f);
+
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128 high = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(values, 16)), highScale);
+        const __m128 low = _mm_cvtepi32_ps(_mm_and_si128(values, lowMask));
+        _mm_storeu_ps(dst + i, _mm_add_ps(high, low));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertUInt32ToDoubleSse2(const uint32_t* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_pd(dst + i, convertUInt32LowToDoubleSse2(values));
+        _mm_storeu_pd(dst + i + 2, convertUInt32LowToDoubleSse2(_mm_shuffle_epi32(values, _MM_SHUFFLE(1, 0, 3, 2))));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+// splits each value into its upper and lower 32 bits; both parts and the scaled upper part are exact,
+// so the sum is rounded once like the scalar cast
+template <typename TFrom, typename TTo>
+void convert64ToDoubleSse2(const TFrom* src, TTo* dst, SizeT count)
+{
+    const __m128d highScale = _mm_set1_pd(4294967296.0);
+
+    SizeT i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i high = _mm_shuffle_epi32(values, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m128i low = _mm_shuffle_epi32(values, _MM_SHUFFLE(2, 0, 2, 0));
+
+        __m128d highDouble;
+        if constexpr (std::is_signed_v<TFrom>)
+            highDouble = _mm_cvtepi32_pd(high);
+        else
+            highDouble = convertUInt32LowToDoubleSse2(high);
+
+        _mm_storeu_pd(dst + i, _mm_add_pd(_mm_mul_pd(highDouble, highScale), convertUInt32LowToDoubleSse2(low)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+// truncating conversions produce the same out-of-range result as the scalar cvtts*2si instructions
+void convertFloatToInt32Sse2(const float* src, int32_t* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_cvttps_epi32(_mm_loadu_ps(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertDoubleToInt32Sse2(const double* src, int32_t* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i low = _mm_cvttpd_epi32(_mm_loadu_pd(src + i));
+        const __m128i high = _mm_cvttpd_epi32(_mm_loadu_pd(src + i + 2));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi64(low, high));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+// packs two vectors of twice as wide integers into one vector of TTo keeping the low-order bits
+template <typename TTo>
+__m128i packTruncatedSse2(__m128i low, __m128i high)
+{
+    if constexpr (sizeof(TTo) == 4)
+    {
+        return _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(low), _mm_castsi128_ps(high), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    else if constexpr (sizeof(TTo) == 2)
+    {
+        // sign-extend the low halves so that the saturating pack keeps them unchanged
+        low = _mm_srai_epi32(_mm_slli_epi32(low, 16), 16);
+        high = _mm_srai_epi32(_mm_slli_epi32(high, 16), 16);
+        return _mm_packs_epi32(low, high);
+    }
+    else
+    {
+        const __m128i mask = _mm_set1_epi16(0xFF);
+        return _mm_packus_epi16(_mm_and_si128(low, mask), _mm_and_si128(high, mask));
+    }
+}
+
+// loads the source values of one destination vector and narrows them one width at a time
+template <typename TFrom, typename TTo>
+__m128i loadTruncatedSse2(const TFrom* src)
+{
+    if constexpr (sizeof(TFrom) == sizeof(TTo))
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    }
+    else
+    {
+        constexpr SizeT half = 8 / sizeof(TTo);
+        const __m128i low = loadTruncatedSse2<TFrom, WiderUnsigned<TTo>>(src);
+        const __m128i high = loadTruncatedSse2<TFrom, WiderUnsigned<TTo>>(src + half);
+        return packTruncatedSse2<TTo>(low, high);
+    }
+}
+
+template <typename TFrom, typename TTo>
+void truncateSse2(const TFrom* src, TTo* dst, SizeT count)
+{
+    constexpr SizeT width = 16 / sizeof(TTo);
+
+    SizeT i = 0;
+    for (; i + width <= count; i += width)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), loadTruncatedSse2<TFrom, TTo>(src + i));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+// upper bits of the widened values: copies of the sign bit for signed sources, zeros for unsigned ones
+template <typename TFrom>
+__m128i extensionBitsSse2(__m128i values)
+{
+    const __m128i zero = _mm_setzero_si128();
+    if constexpr (std::is_unsigned_v<TFrom>)
+        return zero;
+    else if constexpr (sizeof(TFrom) == 1)
+        return _mm_cmpgt_epi8(zero, values);
+    else if constexpr (sizeof(TFrom) == 2)
+        return _mm_cmpgt_epi16(zero, values);
+    else
+        return _mm_cmpgt_epi32(zero, values);
+}
+
+template <typename TFrom, bool High>
+__m128i unpackExtendedSse2(__m128i values, __m128i extension)
+{
+    if constexpr (sizeof(TFrom) == 1)
+        return High ? _mm_unpackhi_epi8(values, extension) : _mm_unpacklo_epi8(values, extension);
+    else if constexpr (sizeof(TFrom) == 2)
+        return High ? _mm_unpackhi_epi16(values, extension) : _mm_unpacklo_epi16(values, extension);
+    else
+        return High ? _mm_unpackhi_epi32(values, extension) : _mm_unpacklo_epi32(values, extension);
+}
+
+// widens one source vector one width at a time and stores the resulting destination vectors
+template <typename TFrom, typename TTo>
+void storeExtendedSse2(__m128i values, TTo* dst)
+{
+    if constexpr (sizeof(TFrom) == sizeof(TTo))
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), values);
+    }
+    else
+    {
+        constexpr SizeT half = 8 / sizeof(TFrom);
+        const __m128i extension = extensionBitsSse2<TFrom>(values);
+        storeExtendedSse2<WiderInteger<TFrom>, TTo>(unpackExtendedSse2<TFrom, false>(values, extension), dst);
+        storeExtendedSse2<WiderInteger<TFrom>, TTo>(unpackExtendedSse2<TFrom, true>(values, extension), dst + half);
+    }
+}
+
+template <typename TFrom, typename TTo>
+void extendSse2(const TFrom* src, TTo* dst, SizeT count)
+{
+    constexpr SizeT width = 16 / sizeof(TFrom);
+
+    SizeT i = 0;
+    for (; i + width <= count; i += width)
+        storeExtendedSse2<TFrom, TTo>(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)), dst + i);
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 __m256i loadInt8AsInt32Avx2(const int8_t* src)
+{
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+
+OPENDAQ_TARGET_AVX2 __m256i loadUInt8AsInt32Avx2(const uint8_t* src)
+{
+    return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src)));
+}
+
+OPENDAQ_TARGET_AVX2 __m256i loadInt16AsInt32Avx2(const int16_t* src)
+{
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+
+OPENDAQ_TARGET_AVX2 __m256i loadUInt16AsInt32Avx2(const uint16_t* src)
+{
+    return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+}
+
+OPENDAQ_TARGET_AVX2 __m256i loadInt32Avx2(const int32_t* src)
+{
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+}
+
+// converts 8 values per iteration through a 32-bit integer vector
+template <typename TFrom, __m256i (*Load)(const TFrom*)>
+OPENDAQ_TARGET_AVX2 void convertToFloatAvx2(const TFrom* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(Load(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, __m256i (*Load)(const TFrom*)>
+OPENDAQ_TARGET_AVX2 void convertToDoubleAvx2(const TFrom* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i values = Load(src + i);
+        _mm256_storeu_pd(dst + i, _mm256_cvtepi32_pd(_mm256_castsi256_si128(values)));
+        _mm256_storeu_pd(dst + i + 4, _mm256_cvtepi32_pd(_mm256_extracti128_si256(values, 1)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 void convertFloatToDoubleAvx2(const float* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 void convertDoubleToFloatAvx2(const double* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 __m256d convertUInt32ToDoubleAvx2(__m128i values)
+{
+    const __m128i offset = _mm_set1_epi32(INT32_MIN);
+    return _mm256_add_pd(_mm256_cvtepi32_pd(_mm_xor_si128(values, offset)), _mm256_set1_pd(2147483648.0));
+}
+
+OPENDAQ_TARGET_AVX2 void convertUInt32ToFloatAvx2(const uint32_t* src, float* dst, SizeT count)
+{
+    const __m256i lowMask = _mm256_set1_epi32(0xFFFF);
+    const __m256 highScale = _mm256_set1_ps(65536.0f);
+
+    SizeT i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256 high = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(values, 16)), highScale);
+        const __m256 low = _mm256_cvtepi32_ps(_mm256_and_si256(values, lowMask));
+        _mm256_storeu_ps(dst + i, _mm256_add_ps(high, low));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 void convertUInt32ToDoubleAvx2(const uint32_t* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm256_storeu_pd(dst + i, convertUInt32ToDoubleAvx2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i))));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, typename TTo>
+OPENDAQ_TARGET_AVX2 void convert64ToDoubleAvx2(const TFrom* src, TTo* dst, SizeT count)
+{
+    const __m256i splitIndex = _mm256_setr_epi32(1, 3, 5, 7, 0, 2, 4, 6);
+    const __m256d highScale = _mm256_set1_pd(4294967296.0);
+
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m256i values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i split = _mm256_permutevar8x32_epi32(values, splitIndex);
+        const __m128i high = _mm256_castsi256_si128(split);
+        const __m128i low = _mm256_extracti128_si256(split, 1);
+
+        __m256d highDouble;
+        if constexpr (std::is_signed_v<TFrom>)
+            highDouble = _mm256_cvtepi32_pd(high);
+        else
+            highDouble = convertUInt32ToDoubleAvx2(high);
+
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_mul_pd(highDouble, highScale), convertUInt32ToDoubleAvx2(low)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 void convertFloatToInt32Avx2(const float* src, int32_t* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 8 <= count; i += 8)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_cvttps_epi32(_mm256_loadu_ps(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+OPENDAQ_TARGET_AVX2 void convertDoubleToInt32Avx2(const double* src, int32_t* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm256_cvttpd_epi32(_mm256_loadu_pd(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TTo>
+OPENDAQ_TARGET_AVX2 __m256i packTruncatedAvx2(__m256i low, __m256i high)
+{
+    __m256i packed;
+    if constexpr (sizeof(TTo) == 4)
+    {
+        packed = _mm256_castps_si256(
+            _mm256_shuffle_ps(_mm256_castsi256_ps(low), _mm256_castsi256_ps(high), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+    else if constexpr (sizeof(TTo) == 2)
+    {
+        low = _mm256_srai_epi32(_mm256_slli_epi32(low, 16), 16);
+        high = _mm256_srai_epi32(_mm256_slli_epi32(high, 16), 16);
+        packed = _mm256_packs_epi32(low, high);
+    }
+    else
+    {
+        const __m256i mask = _mm256_set1_epi16(0xFF);
+        packed = _mm256_packus_epi16(_mm256_and_si256(low, mask), _mm256_and_si256(high, mask));
+    }
+
+    // the packing instructions work within 128-bit lanes, restore the order of the 64-bit blocks
+    return _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+template <typename TFrom, typename TTo>
+OPENDAQ_TARGET_AVX2 __m256i loadTruncatedAvx2(const TFrom* src)
+{
+    if constexpr (sizeof(TFrom) == sizeof(TTo))
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    }
+    else
+    {
+        constexpr SizeT half = 16 / sizeof(TTo);
+        const __m256i low = loadTruncatedAvx2<TFrom, WiderUnsigned<TTo>>(src);
+        const __m256i high = loadTruncatedAvx2<TFrom, WiderUnsigned<TTo>>(src + half);
+        return packTruncatedAvx2<TTo>(low, high);
+    }
+}
+
+template <typename TFrom, typename TTo>
+OPENDAQ_TARGET_AVX2 void truncateAvx2(const TFrom* src, TTo* dst, SizeT count)
+{
+    constexpr SizeT width = 32 / sizeof(TTo);
+
+    SizeT i = 0;
+    for (; i + width <= count; i += width)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), loadTruncatedAvx2<TFrom, TTo>(src + i));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+// loads the source values of one destination vector and widens them with a single vpmovsx/vpmovzx
+template <typename TFrom, typename TTo>
+OPENDAQ_TARGET_AVX2 __m256i loadExtendedAvx2(const TFrom* src)
+{
+    constexpr SizeT bytes = 32 / sizeof(TTo) * sizeof(TFrom);
+
+    __m128i values;
+    if constexpr (bytes == 16)
+    {
+        values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    }
+    else if constexpr (bytes == 8)
+    {
+        values = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+    }
+    else
+    {
+        int32_t packed;
+        std::memcpy(&packed, src, sizeof(packed));
+        values = _mm_cvtsi32_si128(packed);
+    }
+
+    constexpr SizeT from = sizeof(TFrom);
+    constexpr SizeT to = sizeof(TTo);
+    if constexpr (std::is_signed_v<TFrom>)
+    {
+        if constexpr (from == 1 && to == 2)
+            return _mm256_cvtepi8_epi16(values);
+        else if constexpr (from == 1 && to == 4)
+            return _mm256_cvtepi8_epi32(values);
+        else if constexpr (from == 1 && to == 8)
+            return _mm256_cvtepi8_epi64(values);
+        else if constexpr (from == 2 && to == 4)
+            return _mm256_cvtepi16_epi32(values);
+        else if constexpr (from == 2 && to == 8)
+            return _mm256_cvtepi16_epi64(values);
+        else
+            return _mm256_cvtepi32_epi64(values);
+    }
+    else
+    {
+        if constexpr (from == 1 && to == 2)
+            return _mm256_cvtepu8_epi16(values);
+        else if constexpr (from == 1 && to == 4)
+            return _mm256_cvtepu8_epi32(values);
+        else if constexpr (from == 1 && to == 8)
+            return _mm256_cvtepu8_epi64(values);
+        else if constexpr (from == 2 && to == 4)
+            return _mm256_cvtepu16_epi32(values);
+        else if constexpr (from == 2 && to == 8)
+            return _mm256_cvtepu16_epi64(values);
+        else
+            return _mm256_cvtepu32_epi64(values);
+    }
+}
+
+template <typename TFrom, typename TTo>
+OPENDAQ_TARGET_AVX2 void extendAvx2(const TFrom* src, TTo* dst, SizeT count)
+{
+    constexpr SizeT width = 32 / sizeof(TTo);
+
+    SizeT i = 0;
+    for (; i + width <= count; i += width)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), loadExtendedAvx2<TFrom, TTo>(src + i));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, typename TTo>
+ConvertFunction<TFrom, TTo> selectKernel(ConvertFunction<TFrom, TTo> avx2, ConvertFunction<TFrom, TTo> sse2)
+{
+    return hasAvx2() ? avx2 : sse2;
+}
+
+#define OPENDAQ_SELECT_INT_KERNEL(TFrom, TTo, Name, LoadName)                                                  \
+    selectKernel<TFrom, TTo>(&convertTo##Name##Avx2<TFrom, &LoadName##Avx2>, &convertTo##Name##Sse2<TFrom, &LoadName##Sse2>)
+
+#define OPENDAQ_SELECT_KERNEL(TFrom, TTo, Name) selectKernel<TFrom, TTo>(&Name##Avx2, &Name##Sse2)
+
+#define OPENDAQ_SELECT_TEMPLATE_KERNEL(TFrom, TTo, Name)                                                      \
+    selectKernel<TFrom, TTo>(&Name##Avx2<TFrom, TTo>, &Name##Sse2<TFrom, TTo>)
+
+#elif defined(OPENDAQ_SAMPLE_CONVERSION_NEON)
+
+int32x4_t loadInt8AsInt32Neon(const int8_t* src)
+{
+    int8x8_t bytes = vdup_n_s8(0);
+    bytes = vld1_lane_s8(src, bytes, 0);
+    bytes = vld1_lane_s8(src + 1, bytes, 1);
+    bytes = vld1_lane_s8(src + 2, bytes, 2);
+    bytes = vld1_lane_s8(src + 3, bytes, 3);
+    return vmovl_s16(vget_low_s16(vmovl_s8(bytes)));
+}
+
+int32x4_t loadUInt8AsInt32Neon(const uint8_t* src)
+{
+    uint8x8_t bytes = vdup_n_u8(0);
+    bytes = vld1_lane_u8(src, bytes, 0);
+    bytes = vld1_lane_u8(src + 1, bytes, 1);
+    bytes = vld1_lane_u8(src + 2, bytes, 2);
+    bytes = vld1_lane_u8(src + 3, bytes, 3);
+    return vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(vmovl_u8(bytes))));
+}
+
+int32x4_t loadInt16AsInt32Neon(const int16_t* src)
+{
+    return vmovl_s16(vld1_s16(src));
+}
+
+int32x4_t loadUInt16AsInt32Neon(const uint16_t* src)
+{
+    return vreinterpretq_s32_u32(vmovl_u16(vld1_u16(src)));
+}
+
+int32x4_t loadInt32Neon(const int32_t* src)
+{
+    return vld1q_s32(src);
+}
+
+template <typename TFrom, int32x4_t (*Load)(const TFrom*)>
+void convertToFloatNeon(const TFrom* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvtq_f32_s32(Load(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, int32x4_t (*Load)(const TFrom*)>
+void convertToDoubleNeon(const TFrom* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const int32x4_t values = Load(src + i);
+        vst1q_f64(dst + i, vcvtq_f64_s64(vmovl_s32(vget_low_s32(values))));
+        vst1q_f64(dst + i + 2, vcvtq_f64_s64(vmovl_high_s32(values)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertFloatToDoubleNeon(const float* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t values = vld1q_f32(src + i);
+        vst1q_f64(dst + i, vcvt_f64_f32(vget_low_f32(values)));
+        vst1q_f64(dst + i + 2, vcvt_high_f64_f32(values));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertDoubleToFloatNeon(const double* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x2_t low = vcvt_f32_f64(vld1q_f64(src + i));
+        vst1q_f32(dst + i, vcvt_high_f32_f64(low, vld1q_f64(src + i + 2)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertUInt32ToFloatNeon(const uint32_t* src, float* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_f32(dst + i, vcvtq_f32_u32(vld1q_u32(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertUInt32ToDoubleNeon(const uint32_t* src, double* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32x4_t values = vld1q_u32(src + i);
+        vst1q_f64(dst + i, vcvtq_f64_u64(vmovl_u32(vget_low_u32(values))));
+        vst1q_f64(dst + i + 2, vcvtq_f64_u64(vmovl_high_u32(values)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, typename TTo>
+void convert64ToDoubleNeon(const TFrom* src, TTo* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 2 <= count; i += 2)
+    {
+        if constexpr (std::is_signed_v<TFrom>)
+            vst1q_f64(dst + i, vcvtq_f64_s64(vld1q_s64(src + i)));
+        else
+            vst1q_f64(dst + i, vcvtq_f64_u64(vld1q_u64(src + i)));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+// fcvtzs saturates like the scalar conversion
+void convertFloatToInt32Neon(const float* src, int32_t* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+        vst1q_s32(dst + i, vcvtq_s32_f32(vld1q_f32(src + i)));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+void convertDoubleToInt32Neon(const double* src, int32_t* dst, SizeT count)
+{
+    SizeT i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const int32x2_t low = vqmovn_s64(vcvtq_s64_f64(vld1q_f64(src + i)));
+        const int32x2_t high = vqmovn_s64(vcvtq_s64_f64(vld1q_f64(src + i + 2)));
+        vst1q_s32(dst + i, vcombine_s32(low, high));
+    }
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TTo>
+uint8x16_t packTruncatedNeon(uint8x16_t low, uint8x16_t high)
+{
+    if constexpr (sizeof(TTo) == 4)
+    {
+        const uint32x4_t packed = vcombine_u32(vmovn_u64(vreinterpretq_u64_u8(low)), vmovn_u64(vreinterpretq_u64_u8(high)));
+        return vreinterpretq_u8_u32(packed);
+    }
+    else if constexpr (sizeof(TTo) == 2)
+    {
+        const uint16x8_t packed = vcombine_u16(vmovn_u32(vreinterpretq_u32_u8(low)), vmovn_u32(vreinterpretq_u32_u8(high)));
+        return vreinterpretq_u8_u16(packed);
+    }
+    else
+    {
+        return vcombine_u8(vmovn_u16(vreinterpretq_u16_u8(low)), vmovn_u16(vreinterpretq_u16_u8(high)));
+    }
+}
+
+template <typename TFrom, typename TTo>
+uint8x16_t loadTruncatedNeon(const TFrom* src)
+{
+    if constexpr (sizeof(TFrom) == sizeof(TTo))
+    {
+        return vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+    }
+    else
+    {
+        constexpr SizeT half = 8 / sizeof(TTo);
+        const uint8x16_t low = loadTruncatedNeon<TFrom, WiderUnsigned<TTo>>(src);
+        const uint8x16_t high = loadTruncatedNeon<TFrom, WiderUnsigned<TTo>>(src + half);
+        return packTruncatedNeon<TTo>(low, high);
+    }
+}
+
+template <typename TFrom, typename TTo>
+void truncateNeon(const TFrom* src, TTo* dst, SizeT count)
+{
+    constexpr SizeT width = 16 / sizeof(TTo);
+
+    SizeT i = 0;
+    for (; i + width <= count; i += width)
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), loadTruncatedNeon<TFrom, TTo>(src + i));
+    convertScalar(src + i, dst + i, count - i);
+}
+
+template <typename TFrom, bool High>
+uint8x16_t widenNeon(uint8x16_t values)
+{
+    if constexpr (std::is_signed_v<TFrom> && sizeof(TFrom) == 1)
+    {
+        const int8x16_t typed = vreinterpretq_s8_u8(values);
+        return vreinterpretq_u8_s16(High ? vmovl_high_s8(typed) : vmovl_s8(vget_low_s8(typed)));
+    }
+    else if constexpr (std::is_signed_v<TFrom> && sizeof(TFrom) == 2)
+    {
+        const int16x8_t typed = vreinterpretq_s16_u8(values);
+        return vreinterpretq_u8_s32(High ? vmovl_high_s16(typed) : vmovl_s16(vget_low_s16(typed)));
+    }
+    else if constexpr (std::is_signed_v<TFrom>)
+    {
+        const int32x4_t typed = vreinterpretq_s32_u8(values);
+        return vreinterpretq_u8_s64(High ? vmovl_high_s32(typed) : vmovl_s32(vget_low_s32(typed)));
+    }
+    else if constexpr (sizeof(TFrom) == 1)
+    {
+        return vreinterpretq_u8_u16(High ? vmovl_high_u8(values) : vmovl_u8(vget_low_u8(values)));
+    }
+    else if constexpr (sizeof(TFrom) == 2)
+    {
+        const uint16x8_t typed = vreinterpretq_u16_u8(values);
+        return vreinterpretq_u8_u32(High ? vmovl_high_u16(typed) : vmovl_u16(vget_low_u16(typed)));
+    }
+    else
+    {
+        const uint32x4_t typed = vreinterpretq_u32_u8(values);
+        return vreinterpretq_u8_u64(High ? vmovl_high_u32(typed) : vmovl_u32(vget_low_u32(typed)));
+    }
+}
+
+template <typename TFrom, typename TTo>
+void storeExtendedNeon(uint8x16_t values, TTo* dst)
+{
+    if constexpr (sizeof(TFrom) == sizeof(TTo))
+    {
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst), values);
+    }
+    else
+    {
+        constexpr SizeT half = 8 / sizeof(TFrom);
+        storeExtendedNeon<WiderInteger<TFrom>, TTo>(widenNeon<TFrom, false>(values), dst);
+        storeExtendedNeon<WiderInteger<TFrom>, TTo>(widenNeon<TFrom, true>(values), dst + half);
+    }
+}
+
+template <typename TFrom, typename TTo>
+void extendNeon(const TFrom* src, TTo* dst, SizeT count)
+{
+    constexpr SizeT width = 16 / sizeof(TFrom);
+
+    SizeT i = 0;
+    for (; i + width <= count; i += width)
+        storeExtendedNeon<TFrom, TTo>(vld1q_u8(reinterpret_cast<const uint8_t*>(src + i)), dst + i);
+    convertScalar(src + i, dst + i, count - i);
+}
+
+#define OPENDAQ_SELECT_INT_KERNEL(TFrom, TTo, Name, LoadName) &convertTo##Name##Neon<TFrom, &LoadName##Neon>
+#define OPENDAQ_SELECT_KERNEL(TFrom, TTo, Name) &Name##Neon
+#define OPENDAQ_SELECT_TEMPLATE_KERNEL(TFrom, TTo, Name) &Name##Neon<TFrom, TTo>
+
+#else
+
+#define OPENDAQ_SELECT_INT_KERNEL(TFrom, TTo, Name, LoadName) &convertScalar<TFrom, TTo>
+#define OPENDAQ_SELECT_KERNEL(TFrom, TTo, Name) &convertScalar<TFrom, TTo>
+#define OPENDAQ_SELECT_TEMPLATE_KERNEL(TFrom, TTo, Name) &convertScalar<TFrom, TTo>
+
+#endif
+
+}
+
+#define OPENDAQ_DEFINE_CONVERSION(TFrom, TTo, Kernel)               \
+    void convertValues(const TFrom* src, TTo* dst, SizeT count)     \
+    {                                                               \
+        static const ConvertFunction<TFrom, TTo> kernel = Kernel;   \
+        kernel(src, dst, count);                                    \
+    }
+
+OPENDAQ_DEFINE_CONVERSION(int8_t, float, OPENDAQ_SELECT_INT_KERNEL(int8_t, float, Float, loadInt8AsInt32))
+OPENDAQ_DEFINE_CONVERSION(int8_t, double, OPENDAQ_SELECT_INT_KERNEL(int8_t, double, Double, loadInt8AsInt32))
+OPENDAQ_DEFINE_CONVERSION(uint8_t, float, OPENDAQ_SELECT_INT_KERNEL(uint8_t, float, Float, loadUInt8AsInt32))
+OPENDAQ_DEFINE_CONVERSION(uint8_t, double, OPENDAQ_SELECT_INT_KERNEL(uint8_t, double, Double, loadUInt8AsInt32))
+OPENDAQ_DEFINE_CONVERSION(int16_t, float, OPENDAQ_SELECT_INT_KERNEL(int16_t, float, Float, loadInt16AsInt32))
+OPENDAQ_DEFINE_CONVERSION(int16_t, double, OPENDAQ_SELECT_INT_KERNEL(int16_t, double, Double, loadInt16AsInt32))
+OPENDAQ_DEFINE_CONVERSION(uint16_t, float, OPENDAQ_SELECT_INT_KERNEL(uint16_t, float, Float, loadUInt16AsInt32))
+OPENDAQ_DEFINE_CONVERSION(uint16_t, double, OPENDAQ_SELECT_INT_KERNEL(uint16_t, double, Double, loadUInt16AsInt32))
+OPENDAQ_DEFINE_CONVERSION(int32_t, float, OPENDAQ_SELECT_INT_KERNEL(int32_t, float, Float, loadInt32))
+OPENDAQ_DEFINE_CONVERSION(int32_t, double, OPENDAQ_SELECT_INT_KERNEL(int32_t, double, Double, loadInt32))
+OPENDAQ_DEFINE_CONVERSION(uint32_t, float, OPENDAQ_SELECT_KERNEL(uint32_t, float, convertUInt32ToFloat))
+OPENDAQ_DEFINE_CONVERSION(uint32_t, double, OPENDAQ_SELECT_KERNEL(uint32_t, double, convertUInt32ToDouble))
+OPENDAQ_DEFINE_CONVERSION(int64_t, double, OPENDAQ_SELECT_TEMPLATE_KERNEL(int64_t, double, convert64ToDouble))
+OPENDAQ_DEFINE_CONVERSION(uint64_t, double, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint64_t, double, convert64ToDouble))
+OPENDAQ_DEFINE_CONVERSION(float, double, OPENDAQ_SELECT_KERNEL(float, double, convertFloatToDouble))
+OPENDAQ_DEFINE_CONVERSION(double, float, OPENDAQ_SELECT_KERNEL(double, float, convertDoubleToFloat))
+OPENDAQ_DEFINE_CONVERSION(float, int32_t, OPENDAQ_SELECT_KERNEL(float, int32_t, convertFloatToInt32))
+OPENDAQ_DEFINE_CONVERSION(double, int32_t, OPENDAQ_SELECT_KERNEL(double, int32_t, convertDoubleToInt32))
+
+OPENDAQ_DEFINE_CONVERSION(uint16_t, uint8_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint16_t, uint8_t, truncate))
+OPENDAQ_DEFINE_CONVERSION(uint32_t, uint8_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint32_t, uint8_t, truncate))
+OPENDAQ_DEFINE_CONVERSION(uint32_t, uint16_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint32_t, uint16_t, truncate))
+OPENDAQ_DEFINE_CONVERSION(uint64_t, uint8_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint64_t, uint8_t, truncate))
+OPENDAQ_DEFINE_CONVERSION(uint64_t, uint16_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint64_t, uint16_t, truncate))
+OPENDAQ_DEFINE_CONVERSION(uint64_t, uint32_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint64_t, uint32_t, truncate))
+OPENDAQ_DEFINE_CONVERSION(int8_t, int16_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(int8_t, int16_t, extend))
+OPENDAQ_DEFINE_CONVERSION(int8_t, int32_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(int8_t, int32_t, extend))
+OPENDAQ_DEFINE_CONVERSION(int8_t, int64_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(int8_t, int64_t, extend))
+OPENDAQ_DEFINE_CONVERSION(int16_t, int32_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(int16_t, int32_t, extend))
+OPENDAQ_DEFINE_CONVERSION(int16_t, int64_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(int16_t, int64_t, extend))
+OPENDAQ_DEFINE_CONVERSION(int32_t, int64_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(int32_t, int64_t, extend))
+OPENDAQ_DEFINE_CONVERSION(uint8_t, uint16_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint8_t, uint16_t, extend))
+OPENDAQ_DEFINE_CONVERSION(uint8_t, uint32_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint8_t, uint32_t, extend))
+OPENDAQ_DEFINE_CONVERSION(uint8_t, uint64_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint8_t, uint64_t, extend))
+OPENDAQ_DEFINE_CONVERSION(uint16_t, uint32_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint16_t, uint32_t, extend))
+OPENDAQ_DEFINE_CONVERSION(uint16_t, uint64_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint16_t, uint64_t, extend))
+OPENDAQ_DEFINE_CONVERSION(uint32_t, uint64_t, OPENDAQ_SELECT_TEMPLATE_KERNEL(uint32_t, uint64_t, extend))
+
+const char* getInstructionSet()
+{
+#if defined(OPENDAQ_SAMPLE_CONVERSION_X86)
+    static const char* instructionSet = hasAvx2() ? "AVX2" : "SSE2";
+    return instructionSet;
+#elif defined(OPENDAQ_SAMPLE_CONVERSION_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+}
+
+END_NAMESPACE_OPENDAQ
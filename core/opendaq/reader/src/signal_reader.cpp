@@ -233,7 +233,7 @@ std::unique_ptr<Comparable> SignalReader::readStartDomain()
         throw InvalidStateException("Packet must have a domain packet assigned!");
     }
 
-    return domainReader->readStart(domainPacket.getData(), info.prevSampleIndex, domainInfo);
+    return domainReader->readStart(domainPacket, info.prevSampleIndex, domainInfo);
 }
 
 void SignalReader::readUntilNextDataPacket()
@@ -269,13 +269,29 @@ bool SignalReader::sync(const Comparable& commonStart)
     while (info.dataPacket.assigned())
     {
         auto domainPacket = info.dataPacket.getDomainPacket();
+        auto domainRule = domainPacket.getDataDescriptor().getRule();
+        auto domainOffset = domainPacket.getOffset();
 
-        info.prevSampleIndex = domainReader->getOffsetTo(
-            domainInfo,
-            commonStart,
-            domainPacket.getData(),
-            domainPacket.getSampleCount()
-        );
+        if (domainRule.assigned() && domainRule.getType() == DataRuleType::Linear && domainOffset.assigned())
+        {
+            // Avoids materializing the implicit domain values just to find the start position
+            info.prevSampleIndex = domainReader->getOffsetToLinear(
+                domainInfo,
+                commonStart,
+                domainOffset,
+                domainRule,
+                domainPacket.getSampleCount()
+            );
+        }
+        else
+        {
+            info.prevSampleIndex = domainReader->getOffsetTo(
+                domainInfo,
+                commonStart,
+                domainPacket.getData(),
+                domainPacket.getSampleCount()
+            );
+        }
 
         if (info.prevSampleIndex == static_cast<SizeT>(-1))
         {
@@ -384,20 +400,6 @@ ErrCode SignalReader::readPackets()
     return errCode;
 }
 
-void* SignalReader::getValuePacketData(const DataPacketPtr& packet) const
-{
-    switch (readMode)
-    {
-        case ReadMode::RawValue:
-        case ReadMode::Unscaled:
-            return packet.getRawData();
-        case ReadMode::Scaled:
-            return packet.getData();
-    }
-
-    throw InvalidOperationException("Unknown Reader read-mode of {}", static_cast<std::underlying_type_t<ReadMode>>(readMode));
-}
-
 ErrCode SignalReader::readPacketData()
 {
     auto remainingSampleCount = info.dataPacket.getSampleCount() - info.prevSampleIndex;
@@ -405,7 +407,7 @@ ErrCode SignalReader::readPacketData()
 
     if (info.values != nullptr)
     {
-        ErrCode errCode = valueReader->readData(getValuePacketData(info.dataPacket), info.prevSampleIndex, &info.values, toRead);
+        ErrCode errCode = valueReader->readPacketValues(info.dataPacket, readMode, info.prevSampleIndex, &info.values, toRead);
         if (OPENDAQ_FAILED(errCode))
         {
             return errCode;
@@ -427,14 +429,14 @@ ErrCode SignalReader::readPacketData()
         LOG_T("[Reading: {} ", port.getSignal().getLocalId());
 
         auto domainPacket = dataPacket.getDomainPacket();
-        ErrCode errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+        ErrCode errCode = domainReader->readPacketDomain(domainPacket, info.prevSampleIndex, &info.domainValues, toRead);
         if (errCode == OPENDAQ_ERR_INVALIDSTATE)
         {
             if (!trySetDomainSampleType(domainPacket))
             {
                 return errCode;
             }
-            errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+            errCode = domainReader->readPacketDomain(domainPacket, info.prevSampleIndex, &info.domainValues, toRead);
         }
 
         LOG_T("]");
@@ -347,7 +347,7 @@ ErrCode StreamReaderImpl::readPacketData()
     auto remainingSampleCount = info.dataPacket.getSampleCount() - info.prevSampleIndex;
     SizeT toRead = std::min(info.remainingToRead, remainingSampleCount);
 
-    ErrCode errCode = valueReader->readData(info.dataPacket.getData(), info.prevSampleIndex, &info.values, toRead);
+    ErrCode errCode = valueReader->readPacketValues(info.dataPacket, readMode, info.prevSampleIndex, &info.values, toRead);
     if (OPENDAQ_FAILED(errCode))
     {
         return errCode;
@@ -362,14 +362,14 @@ ErrCode StreamReaderImpl::readPacketData()
         }
 
         auto domainPacket = dataPacket.getDomainPacket();
-        errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+        errCode = domainReader->readPacketDomain(domainPacket, info.prevSampleIndex, &info.domainValues, toRead);
         if (errCode == OPENDAQ_ERR_INVALIDSTATE)
         {
             if (!trySetDomainSampleType(domainPacket))
             {
                 return errCode;
             }
-            errCode = domainReader->readData(domainPacket.getData(), info.prevSampleIndex, &info.domainValues, toRead);
+            errCode = domainReader->readPacketDomain(domainPacket, info.prevSampleIndex, &info.domainValues, toRead);
         }
 
         if (OPENDAQ_FAILED(errCode))
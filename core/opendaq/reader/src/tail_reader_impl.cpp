@@ -97,7 +97,7 @@ ErrCode TailReaderImpl::readPacket(TailReaderInfo& info, const DataPacketPtr& da
     auto remainingSampleCount = sampleCount - info.offset;
     SizeT toRead = std::min(info.remainingToRead, remainingSampleCount);
 
-    ErrCode errCode = valueReader->readData(getValuePacketData(dataPacket), info.offset, &info.values, toRead);
+    ErrCode errCode = valueReader->readPacketValues(dataPacket, readMode, info.offset, &info.values, toRead);
     if (OPENDAQ_FAILED(errCode))
     {
         return errCode;
@@ -111,14 +111,14 @@ ErrCode TailReaderImpl::readPacket(TailReaderInfo& info, const DataPacketPtr& da
         }
 
         auto domainPacket = dataPacket.getDomainPacket();
-        errCode = domainReader->readData(domainPacket.getData(), info.offset, &info.domainValues, toRead);
+        errCode = domainReader->readPacketDomain(domainPacket, info.offset, &info.domainValues, toRead);
         if (errCode == OPENDAQ_ERR_INVALIDSTATE)
         {
             if (!trySetDomainSampleType(domainPacket))
             {
                 return errCode;
             }
-            errCode = domainReader->readData(domainPacket.getData(), info.offset, &info.domainValues, toRead);
+            errCode = domainReader->readPacketDomain(domainPacket, info.offset, &info.domainValues, toRead);
         }
 
         if (OPENDAQ_FAILED(errCode))
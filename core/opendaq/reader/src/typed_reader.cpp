@@ -4,7 +4,11 @@
 #include <opendaq/reader_errors.h>
 #include <opendaq/signal_errors.h>
 #include <opendaq/multi_typed_reader.h>
+#include <opendaq/sample_conversion.h>
+#include <opendaq/domain_view.h>
 
+#include <algorithm>
+#include <cmath>
 #include <utility>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -31,6 +35,11 @@ struct GreaterEqual
     {
         return Multiply(readValue, multiplier) >= startValue;
     }
+
+    static double ToDouble(T value)
+    {
+        return static_cast<double>(value);
+    }
 };
 
 template <typename T>
@@ -64,6 +73,11 @@ struct GreaterEqual<T, typename std::enable_if_t<daq::IsTemplateOf<T, daq::Range
     {
         return Multiply(readValue.start, multiplier) >= startValue.start;
     }
+
+    static double ToDouble(T value)
+    {
+        return static_cast<double>(value.start);
+    }
 };
 
 template <typename T>
@@ -88,6 +102,110 @@ struct GreaterEqual<T, typename std::enable_if_t<daq::IsTemplateOf<T, daq::Compl
     {
         return Multiply(readValue, multiplier) >= startValue;
     }
+
+    static double ToDouble(T value)
+    {
+        throw NotSupportedException();
+    }
+};
+
+// Returns the first index in [begin, end) for which the predicate holds, assuming the predicate is
+// monotonic over the range (false ... false true ... true). Returns `end` if it never holds.
+template <typename Predicate>
+SizeT findFirstSampleAtOrAfter(SizeT begin, SizeT end, const Predicate& isAtOrAfter)
+{
+    while (begin < end)
+    {
+        const SizeT middle = begin + (end - begin) / 2;
+        if (isAtOrAfter(middle))
+            end = middle;
+        else
+            begin = middle + 1;
+    }
+    return begin;
+}
+
+// Bisection is only valid for domain values that never decrease. Comparing the endpoints is not enough, as a
+// counter that was reset or wrapped around within the packet can dip and recover before its last value. The
+// check is a single branch-light pass, cheaper than the per-sample conversion of the sequential search.
+template <typename T>
+bool isMonotonic(const T* values, SizeT size)
+{
+    if constexpr (daq::IsTemplateOf<T, daq::RangeType>::value)
+        return std::is_sorted(values, values + size, [](const T& lhs, const T& rhs) { return lhs.start < rhs.start; });
+    else
+        return std::is_sorted(values, values + size);
+}
+
+template <typename T>
+struct LinearRule
+{
+    LinearRule(const NumberPtr& packetOffset, const DataRulePtr& rule)
+    {
+        const auto parameters = rule.getParameters();
+        if constexpr (std::is_floating_point_v<T>)
+        {
+            delta = static_cast<T>(parameters.get("delta").template asPtr<INumber>().getFloatValue());
+            offset = static_cast<T>(packetOffset.getFloatValue()) +
+                     static_cast<T>(parameters.get("start").template asPtr<INumber>().getFloatValue());
+        }
+        else
+        {
+            delta = static_cast<T>(parameters.get("delta").template asPtr<INumber>().getIntValue());
+            offset = static_cast<T>(packetOffset.getIntValue()) +
+                     static_cast<T>(parameters.get("start").template asPtr<INumber>().getIntValue());
+        }
+    }
+
+    T valueAt(SizeT index) const
+    {
+        return delta * static_cast<T>(index) + offset;
+    }
+
+    double getDelta() const
+    {
+        return static_cast<double>(delta);
+    }
+
+    double getOffset() const
+    {
+        return static_cast<double>(offset);
+    }
+
+    T delta;
+    T offset;
+};
+
+template <>
+struct LinearRule<RangeType64>
+{
+    using RangeValue = RangeType64::Type;
+
+    LinearRule(const NumberPtr& packetOffset, const DataRulePtr& rule)
+    {
+        const auto parameters = rule.getParameters();
+        delta = parameters.get("delta").asPtr<INumber>().getIntValue();
+        offset = static_cast<RangeValue>(packetOffset.getIntValue()) +
+                 static_cast<RangeValue>(parameters.get("start").asPtr<INumber>().getIntValue());
+    }
+
+    RangeType64 valueAt(SizeT index) const
+    {
+        return RangeType64(static_cast<RangeValue>(index) * delta + offset);
+    }
+
+    double getDelta() const
+    {
+        return static_cast<double>(delta);
+    }
+
+    double getOffset() const
+    {
+        return static_cast<double>(offset);
+    }
+
+    RangeValue delta;
+    RangeValue offset;
 };
 
 template <typename TReadType>
@@ -139,7 +257,7 @@ static bool isSampleTypeConvertibleTo(SampleType sampleType)
 }
 
 template <typename ReadType>
-std::unique_ptr<Comparable> TypedReader<ReadType>::readStart(void* inputBuffer, SizeT offset, const ReaderDomainInfo& domainInfo)
+std::unique_ptr<Comparable> TypedReader<ReadType>::readStart(const DataPacketPtr& domainPacket, SizeT offset, const ReaderDomainInfo& domainInfo)
 {
     if constexpr (std::is_same_v<void*, ReadType>)
     {
@@ -152,7 +270,7 @@ std::unique_ptr<Comparable> TypedReader<ReadType>::readStart(void* inputBuffer,
         void* data = &startDomain;
 
         setTransformIgnore(true);
-        readData(inputBuffer, offset, &data, 1);
+        readPacketDomain(domainPacket, offset, &data, 1);
         setTransformIgnore(false);
 
         return std::make_unique<ComparableValue<ReadType>>(startDomain, domainInfo);
@@ -253,6 +371,56 @@ SizeT TypedReader<ReadType>::getOffsetTo(const ReaderDomainInfo& domainInfo,
     return makeErrorInfo(OPENDAQ_ERR_INVALID_SAMPLE_TYPE, "Packet with invalid sample-type samples encountered", nullptr);
 }
 
+template <typename ReadType>
+SizeT TypedReader<ReadType>::getOffsetToLinear(const ReaderDomainInfo& domainInfo,
+                                               const Comparable& start,
+                                               const NumberPtr& packetOffset,
+                                               const DataRulePtr& rule,
+                                               SizeT size)
+{
+    switch (dataSampleType)
+    {
+        case SampleType::Float32:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::Float32>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::Float64:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::Float64>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::UInt8:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::UInt8>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::Int8:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::Int8>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::Int16:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::Int16>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::UInt16:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::UInt16>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::Int32:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::Int32>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::UInt32:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::UInt32>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::Int64:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::Int64>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::UInt64:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::UInt64>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::RangeInt64:
+            return getOffsetToLinearData<SampleTypeToType<SampleType::RangeInt64>::Type>(domainInfo, start, packetOffset, rule, size);
+        case SampleType::ComplexFloat32:
+        case SampleType::ComplexFloat64:
+        case SampleType::Binary:
+        case SampleType::String:
+        case SampleType::Struct:
+            return makeErrorInfo(
+                OPENDAQ_ERR_NOT_SUPPORTED,
+                fmt::format("Using the SampleType {} as a domain is not supported", dataSampleType),
+                nullptr
+            );
+        case SampleType::Invalid:
+            return makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "Unknown raw data-type, conversion not possible.", nullptr);
+        case SampleType::_count:
+            break;
+    }
+
+    return makeErrorInfo(OPENDAQ_ERR_INVALID_SAMPLE_TYPE, "Packet with invalid sample-type samples encountered", nullptr);
+}
+
 template <typename TReadType>
 template <typename TDataType>
 SizeT TypedReader<TReadType>::getOffsetToData(const ReaderDomainInfo& domainInfo,
@@ -285,6 +453,17 @@ SizeT TypedReader<TReadType>::getOffsetToData(const ReaderDomainInfo& domainInfo
         // [[maybe_unused]]
         // int a = 5;
 
+        if (valuesPerSample == 1 && size > 0 && isMonotonic(dataStart, size))
+        {
+            // Domain values are monotonic so the first sample at or after the start can be found by bisection
+            const SizeT index = findFirstSampleAtOrAfter(0, size, [&](SizeT i)
+            {
+                return GreaterEqual<TReadType>::Check(domainInfo.multiplier, static_cast<TReadType>(dataStart[i]), startValue);
+            });
+
+            return index < size ? index : static_cast<SizeT>(-1);
+        }
+
         for (std::size_t i = 0; i < size * valuesPerSample; ++i)
         {
             // debug
@@ -318,6 +497,82 @@ SizeT TypedReader<TReadType>::getOffsetToData(const ReaderDomainInfo& domainInfo
     }
 }
 
+template <typename TReadType>
+template <typename TDataType>
+SizeT TypedReader<TReadType>::getOffsetToLinearData(const ReaderDomainInfo& domainInfo,
+                                                    const Comparable& start,
+                                                    const NumberPtr& packetOffset,
+                                                    const DataRulePtr& rule,
+                                                    SizeT size) const
+{
+    using namespace reader;
+
+    if constexpr (std::is_convertible_v<TDataType, TReadType>)
+    {
+        const LinearRule<TDataType> linearRule(packetOffset, rule);
+
+        auto* startV = dynamic_cast<const ComparableValue<TReadType>*>(&start);
+        auto startValue = GreaterEqual<TReadType>::GetStart(startV->getValue(), -domainInfo.offset);
+
+        const auto isAtOrAfterStart = [&](SizeT i)
+        {
+            return GreaterEqual<TReadType>::Check(domainInfo.multiplier, static_cast<TReadType>(linearRule.valueAt(i)), startValue);
+        };
+
+        SizeT begin = 0;
+        SizeT end = size;
+
+        const double delta = linearRule.getDelta();
+        if (delta > 0)
+        {
+            // Solve `offset + i * delta >= start` in packet ticks and bisect only a small window around the estimate
+            // to absorb rounding of the multiplier and the floating-point estimate itself
+            constexpr SizeT window = 64;
+
+            const double target = GreaterEqual<TReadType>::ToDouble(startValue) *
+                                  static_cast<double>(domainInfo.multiplier.getDenominator()) /
+                                  static_cast<double>(domainInfo.multiplier.getNumerator());
+            const double estimate = std::ceil((target - linearRule.getOffset()) / delta);
+
+            SizeT guess = 0;
+            if (estimate >= static_cast<double>(size))
+                guess = size;
+            else if (estimate > 0)
+                guess = static_cast<SizeT>(estimate);
+
+            const SizeT windowBegin = guess > window ? guess - window : 0;
+            const SizeT windowEnd = std::min(size, guess + window);
+
+            if ((windowBegin == 0 || !isAtOrAfterStart(windowBegin - 1)) && (windowEnd == size || isAtOrAfterStart(windowEnd)))
+            {
+                begin = windowBegin;
+                end = windowEnd;
+            }
+        }
+        else
+        {
+            // Not monotonic, fall back to the sequential search
+            for (SizeT i = 0; i < size; ++i)
+            {
+                if (isAtOrAfterStart(i))
+                    return i;
+            }
+            return static_cast<SizeT>(-1);
+        }
+
+        const SizeT index = findFirstSampleAtOrAfter(begin, end, isAtOrAfterStart);
+        return index < size ? index : static_cast<SizeT>(-1);
+    }
+    else
+    {
+        return makeErrorInfo(
+            OPENDAQ_ERR_NOT_SUPPORTED,
+            "Implicit conversion from packet data-type to the read data-type is not supported.",
+            nullptr
+        );
+    }
+}
+
 template <typename TReadType>
 template <typename TDataType>
 ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const
@@ -357,15 +612,168 @@ ErrCode TypedReader<TReadType>::readValues(void* inputBuffer, SizeT offset, void
         }
         else
         {
-            for (std::size_t i = 0; i < toRead * valuesPerSample; ++i)
-            {
-                dataOut[i] = (TReadType) dataStart[i];
-            }
+            sample_conversion::convert(dataStart, dataOut, toRead * valuesPerSample);
 
             // Set the pointer to the value after the last copied one
-            *outputBuffer = &dataOut[toRead];
+            *outputBuffer = dataOut + (valuesPerSample * toRead);
+        }
+
+        return OPENDAQ_SUCCESS;
+    }
+    else
+    {
+        return makeErrorInfo(
+            OPENDAQ_ERR_NOT_SUPPORTED,
+            "Implicit conversion from packet data-type to the read data-type is not supported.",
+            nullptr
+        );
+    }
+}
+
+template <typename ReadType>
+ErrCode TypedReader<ReadType>::readPacketValues(const DataPacketPtr& packet, ReadMode mode, SizeT offset, void** outputBuffer, SizeT count)
+{
+    if (mode == ReadMode::Scaled && fusedScaling && (ignoreTransform || !transformFunction.assigned()))
+    {
+        switch (scalingInputType)
+        {
+            case SampleType::Float32:
+                return readScaledValues<SampleTypeToType<SampleType::Float32>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::Float64:
+                return readScaledValues<SampleTypeToType<SampleType::Float64>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::UInt8:
+                return readScaledValues<SampleTypeToType<SampleType::UInt8>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::Int8:
+                return readScaledValues<SampleTypeToType<SampleType::Int8>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::UInt16:
+                return readScaledValues<SampleTypeToType<SampleType::UInt16>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::Int16:
+                return readScaledValues<SampleTypeToType<SampleType::Int16>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::UInt32:
+                return readScaledValues<SampleTypeToType<SampleType::UInt32>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::Int32:
+                return readScaledValues<SampleTypeToType<SampleType::Int32>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::UInt64:
+                return readScaledValues<SampleTypeToType<SampleType::UInt64>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            case SampleType::Int64:
+                return readScaledValues<SampleTypeToType<SampleType::Int64>::Type>(packet.getRawData(), offset, outputBuffer, count);
+            default:
+                break;
+        }
+    }
+
+    return Reader::readPacketValues(packet, mode, offset, outputBuffer, count);
+}
+
+template <typename ReadType>
+ErrCode TypedReader<ReadType>::readPacketDomain(const DataPacketPtr& domainPacket, SizeT offset, void** outputBuffer, SizeT count)
+{
+    if (linearDomain)
+    {
+        switch (dataSampleType)
+        {
+            case SampleType::Float32:
+                return readLinearDomain<SampleTypeToType<SampleType::Float32>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::Float64:
+                return readLinearDomain<SampleTypeToType<SampleType::Float64>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::UInt8:
+                return readLinearDomain<SampleTypeToType<SampleType::UInt8>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::Int8:
+                return readLinearDomain<SampleTypeToType<SampleType::Int8>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::UInt16:
+                return readLinearDomain<SampleTypeToType<SampleType::UInt16>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::Int16:
+                return readLinearDomain<SampleTypeToType<SampleType::Int16>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::UInt32:
+                return readLinearDomain<SampleTypeToType<SampleType::UInt32>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::Int32:
+                return readLinearDomain<SampleTypeToType<SampleType::Int32>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::UInt64:
+                return readLinearDomain<SampleTypeToType<SampleType::UInt64>::Type>(domainPacket, offset, outputBuffer, count);
+            case SampleType::Int64:
+                return readLinearDomain<SampleTypeToType<SampleType::Int64>::Type>(domainPacket, offset, outputBuffer, count);
+            default:
+                break;
+        }
+    }
+
+    return Reader::readPacketDomain(domainPacket, offset, outputBuffer, count);
+}
+
+template <typename TReadType>
+template <typename TDataType>
+ErrCode TypedReader<TReadType>::readLinearDomain(const DataPacketPtr& domainPacket, SizeT offset, void** outputBuffer, SizeT toRead)
+{
+    if (!outputBuffer)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    if constexpr (std::is_arithmetic_v<TReadType> && std::is_convertible_v<TDataType, TReadType>)
+    {
+        const DomainView<TDataType> domainView(domainPacket);
+        const auto dataOut = static_cast<TReadType*>(*outputBuffer);
+
+        if (!ignoreTransform && transformFunction.assigned())
+        {
+            // The transform function expects the domain values in a buffer, so only the values read are computed
+            linearDomainBuffer.resize(toRead * sizeof(TDataType));
+            const auto dataStart = reinterpret_cast<TDataType*>(linearDomainBuffer.data());
+            domainView.copyTo(dataStart, offset, toRead);
+
+            transformFunction.call((Int) dataStart, (Int) dataOut, toRead, dataDescriptor);
+
+            *outputBuffer = dataOut + toRead;
+            return OPENDAQ_SUCCESS;
         }
 
+        *outputBuffer = domainView.copyTo(dataOut, offset, toRead);
+        return OPENDAQ_SUCCESS;
+    }
+    else
+    {
+        return makeErrorInfo(
+            OPENDAQ_ERR_NOT_SUPPORTED,
+            "Implicit conversion from packet data-type to the read data-type is not supported.",
+            nullptr
+        );
+    }
+}
+
+template <typename TReadType>
+template <typename TRawType>
+ErrCode TypedReader<TReadType>::readScaledValues(void* rawBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const
+{
+    switch (scalingOutputType)
+    {
+        case ScaledSampleType::Float32:
+            return readScaledValues<TRawType, SampleTypeToType<SampleType::Float32>::Type>(rawBuffer, offset, outputBuffer, toRead);
+        case ScaledSampleType::Float64:
+            return readScaledValues<TRawType, SampleTypeToType<SampleType::Float64>::Type>(rawBuffer, offset, outputBuffer, toRead);
+        case ScaledSampleType::Invalid:
+            break;
+    }
+
+    return makeErrorInfo(OPENDAQ_ERR_INVALID_SAMPLE_TYPE, "Post-scaling with an invalid output sample-type encountered", nullptr);
+}
+
+template <typename TReadType>
+template <typename TRawType, typename TScaledType>
+ErrCode TypedReader<TReadType>::readScaledValues(void* rawBuffer, SizeT offset, void** outputBuffer, SizeT toRead) const
+{
+    if (!rawBuffer || !outputBuffer)
+        return OPENDAQ_ERR_ARGUMENT_NULL;
+
+    if constexpr (std::is_arithmetic_v<TReadType> && std::is_convertible_v<TScaledType, TReadType>)
+    {
+        const auto dataStart = static_cast<TRawType*>(rawBuffer) + (offset * valuesPerSample);
+        const auto dataOut = static_cast<TReadType*>(*outputBuffer);
+
+        sample_conversion::scaleLinear(dataStart,
+                                       dataOut,
+                                       toRead * valuesPerSample,
+                                       static_cast<TScaledType>(scalingScale),
+                                       static_cast<TScaledType>(scalingOffset));
+
+        *outputBuffer = dataOut + (valuesPerSample * toRead);
         return OPENDAQ_SUCCESS;
     }
     else
@@ -425,6 +833,20 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
             dataSampleType = postScaling.getInputSampleType();
         }
 
+        fusedScaling = false;
+        if constexpr (std::is_arithmetic_v<ReadType>)
+        {
+            if (postScaling.assigned() && readMode == ReadMode::Scaled && postScaling.getType() == ScalingType::Linear)
+            {
+                const auto parameters = postScaling.getParameters();
+                fusedScaling = true;
+                scalingInputType = postScaling.getInputSampleType();
+                scalingOutputType = postScaling.getOutputSampleType();
+                scalingScale = parameters.get("scale").template asPtr<INumber>().getFloatValue();
+                scalingOffset = parameters.get("offset").template asPtr<INumber>().getFloatValue();
+            }
+        }
+
         if constexpr (std::is_same_v<ReadType, void*>)
         {
             valid = true;
@@ -441,6 +863,9 @@ bool TypedReader<ReadType>::handleDescriptorChanged(DataDescriptorPtr& descripto
             valuesPerSample = dimensions[0].getSize();
         }
 
+        const auto rule = descriptor.getRule();
+        linearDomain = !postScaling.assigned() && valuesPerSample == 1 && rule.assigned() && rule.getType() == DataRuleType::Linear;
+
         dataDescriptor = descriptor;
     }
 
@@ -463,6 +888,25 @@ Reader::Reader(FunctionPtr transform)
 {
 }
 
+ErrCode Reader::readPacketValues(const DataPacketPtr& packet, ReadMode mode, SizeT offset, void** outputBuffer, SizeT count)
+{
+    switch (mode)
+    {
+        case ReadMode::Unscaled:
+        case ReadMode::RawValue:
+            return readData(packet.getRawData(), offset, outputBuffer, count);
+        case ReadMode::Scaled:
+            return readData(packet.getData(), offset, outputBuffer, count);
+    }
+
+    return makeErrorInfo(OPENDAQ_ERR_INVALIDPARAMETER, fmt::format("Unknown Reader read-mode of {}", static_cast<std::underlying_type_t<ReadMode>>(mode)), nullptr);
+}
+
+ErrCode Reader::readPacketDomain(const DataPacketPtr& domainPacket, SizeT offset, void** outputBuffer, SizeT count)
+{
+    return readData(domainPacket.getData(), offset, outputBuffer, count);
+}
+
 bool Reader::isUndefined() const noexcept
 {
     return false;
@@ -6,6 +6,8 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <cstring>
+#include <numeric>
 #include <thread>
 #include <utility>
 #include <future>
@@ -268,6 +270,22 @@ static DataPacketPtr createPacket(daq::SizeT numSamples, daq::Int offset, const
     return daq::DataPacketWithDomain(domainPacket, read.valueDescriptor, numSamples);
 }
 
+// The domain signal keeps its nominal linear descriptor while the packet carries the ticks explicitly,
+// so the reader has to search the domain values instead of solving the linear rule
+static DataPacketPtr createExplicitDomainPacket(const ReadSignal& read, const std::vector<ClockTick>& ticks)
+{
+    const auto domainDescriptor = DataDescriptorBuilderCopy(read.getDomainDescriptor()).setRule(ExplicitDataRule()).build();
+    auto domainPacket = DataPacket(domainDescriptor, ticks.size());
+    std::memcpy(domainPacket.getRawData(), ticks.data(), ticks.size() * sizeof(ClockTick));
+
+    auto packet = DataPacketWithDomain(domainPacket, read.valueDescriptor, ticks.size());
+    auto* data = static_cast<double*>(packet.getRawData());
+    for (SizeT i = 0; i < ticks.size(); ++i)
+        data[i] = static_cast<double>(i);
+
+    return packet;
+}
+
 TEST_F(MultiReaderTest, SignalStartDomainFrom0)
 {
     constexpr const auto NUM_SIGNALS = 3;
@@ -319,6 +337,176 @@ TEST_F(MultiReaderTest, SignalStartDomainFrom0)
     ASSERT_THAT(time[2], ElementsAreArray(time[0]));
 }
 
+TEST_F(MultiReaderTest, SignalStartDomainFrom0LargePackets)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+
+    // prevent vector from re-allocating, so we have "stable" pointers
+    readSignals.reserve(3);
+
+    auto& sig0 = addSignal(0, 100003, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, 100007, createDomainSignal("2022-09-27T00:02:04+00:00"));
+    auto& sig2 = addSignal(0, 100011, createDomainSignal("2022-09-27T00:02:04.123+00:00"));
+
+    auto multi = MultiReader(signalsToList());
+
+    sig0.createAndSendPacket(0);
+    sig1.createAndSendPacket(0);
+    sig2.createAndSendPacket(0);
+
+    constexpr const SizeT SAMPLES = 5u;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1], values[2]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1], domain[2]};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+
+    ASSERT_EQ(count, SAMPLES);
+
+    std::array<std::chrono::system_clock::time_point[SAMPLES], NUM_SIGNALS> time{};
+    printData<std::chrono::microseconds>(SAMPLES, time, values, domain);
+
+    ASSERT_THAT(time[1], ElementsAreArray(time[0]));
+    ASSERT_THAT(time[2], ElementsAreArray(time[0]));
+}
+
+TEST_F(MultiReaderTest, SignalStartExplicitDomainLargePackets)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+
+    // prevent vector from re-allocating, so we have "stable" pointers
+    readSignals.reserve(3);
+
+    auto& sig0 = addSignal(0, 100003, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, 100007, createDomainSignal("2022-09-27T00:02:04+00:00"));
+    auto& sig2 = addSignal(0, 100011, createDomainSignal("2022-09-27T00:02:04.123+00:00"));
+
+    auto multi = MultiReader(signalsToList());
+
+    for (auto* sig : {&sig0, &sig1, &sig2})
+    {
+        std::vector<ClockTick> ticks(sig->packetSize);
+        std::iota(ticks.begin(), ticks.end(), 0);
+        sig->signal.sendPacket(createExplicitDomainPacket(*sig, ticks));
+    }
+
+    constexpr const SizeT SAMPLES = 5u;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1], values[2]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1], domain[2]};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+
+    ASSERT_EQ(count, SAMPLES);
+
+    std::array<std::chrono::system_clock::time_point[SAMPLES], NUM_SIGNALS> time{};
+    printData<std::chrono::microseconds>(SAMPLES, time, values, domain);
+
+    ASSERT_THAT(time[1], ElementsAreArray(time[0]));
+    ASSERT_THAT(time[2], ElementsAreArray(time[0]));
+
+    // the common start is 1123 ms after the first sample of sig0 and 123 ms after the first sample of sig1
+    ASSERT_EQ(values[0][0], 1123.0);
+    ASSERT_EQ(values[1][0], 123.0);
+    ASSERT_EQ(values[2][0], 0.0);
+}
+
+TEST_F(MultiReaderTest, SignalStartExplicitDomainRestartedWithinPacket)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+
+    // prevent vector from re-allocating, so we have "stable" pointers
+    readSignals.reserve(3);
+
+    auto& sig0 = addSignal(0, 4000, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, 732, createDomainSignal("2022-09-27T00:02:04+00:00"));
+    auto& sig2 = addSignal(0, 843, createDomainSignal("2022-09-27T00:02:04.123+00:00"));
+
+    auto multi = MultiReader(signalsToList());
+
+    // ticks 1000 .. 1999 followed by a counter that restarted three times from 0 .. 999, which would lead
+    // a bisection past the real start position
+    std::vector<ClockTick> ticks(sig0.packetSize);
+    for (SizeT i = 0; i < ticks.size(); ++i)
+        ticks[i] = i < 1000 ? static_cast<ClockTick>(1000 + i) : static_cast<ClockTick>(i % 1000);
+
+    sig0.signal.sendPacket(createExplicitDomainPacket(sig0, ticks));
+    sig1.createAndSendPacket(0);
+    sig2.createAndSendPacket(0);
+
+    constexpr const SizeT SAMPLES = 5u;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1], values[2]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1], domain[2]};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+
+    ASSERT_EQ(count, SAMPLES);
+
+    std::array<std::chrono::system_clock::time_point[SAMPLES], NUM_SIGNALS> time{};
+    printData<std::chrono::microseconds>(SAMPLES, time, values, domain);
+
+    ASSERT_THAT(time[1], ElementsAreArray(time[0]));
+    ASSERT_THAT(time[2], ElementsAreArray(time[0]));
+    ASSERT_EQ(values[0][0], 123.0);
+}
+
+TEST_F(MultiReaderTest, SignalStartExplicitDomainDipWithinPacket)
+{
+    constexpr const auto NUM_SIGNALS = 3;
+
+    // prevent vector from re-allocating, so we have "stable" pointers
+    readSignals.reserve(3);
+
+    auto& sig0 = addSignal(0, 4000, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, 732, createDomainSignal("2022-09-27T00:02:04+00:00"));
+    auto& sig2 = addSignal(0, 843, createDomainSignal("2022-09-27T00:02:04.123+00:00"));
+
+    auto multi = MultiReader(signalsToList());
+
+    // ticks 1000 .. 1999, a counter that restarted twice from 0 .. 999 and then 3000 .. 3999; the last value
+    // follows the first one, but the values in between are not monotonic
+    std::vector<ClockTick> ticks(sig0.packetSize);
+    for (SizeT i = 0; i < ticks.size(); ++i)
+        ticks[i] = i < 1000 ? static_cast<ClockTick>(1000 + i) : i < 3000 ? static_cast<ClockTick>(i % 1000) : static_cast<ClockTick>(i);
+
+    sig0.signal.sendPacket(createExplicitDomainPacket(sig0, ticks));
+    sig1.createAndSendPacket(0);
+    sig2.createAndSendPacket(0);
+
+    constexpr const SizeT SAMPLES = 5u;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    std::array<ClockTick[SAMPLES], NUM_SIGNALS> domain{};
+
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1], values[2]};
+    void* domainPerSignal[NUM_SIGNALS]{domain[0], domain[1], domain[2]};
+
+    SizeT count{SAMPLES};
+    multi.readWithDomain(valuesPerSignal, domainPerSignal, &count);
+
+    ASSERT_EQ(count, SAMPLES);
+
+    std::array<std::chrono::system_clock::time_point[SAMPLES], NUM_SIGNALS> time{};
+    printData<std::chrono::microseconds>(SAMPLES, time, values, domain);
+
+    ASSERT_THAT(time[1], ElementsAreArray(time[0]));
+    ASSERT_THAT(time[2], ElementsAreArray(time[0]));
+    ASSERT_EQ(values[0][0], 123.0);
+}
+
 TEST_F(MultiReaderTest, SignalStartDomainFrom0SkipSamples)
 {
     constexpr const auto NUM_SIGNALS = 3;
@@ -617,6 +805,56 @@ TEST_F(MultiReaderTest, SignalStartDomainFrom0Timeout)
     ASSERT_THAT(time[2], ElementsAreArray(time[0]));
 }
 
+TEST_F(MultiReaderTest, TimeoutReadWakesOnData)
+{
+    constexpr const auto NUM_SIGNALS = 2;
+    constexpr const auto PACKET_SIZE = 100;
+
+    // prevent vector from re-allocating so we have "stable" pointers
+    readSignals.reserve(2);
+
+    auto& sig0 = addSignal(0, PACKET_SIZE, createDomainSignal("2022-09-27T00:02:03+00:00"));
+    auto& sig1 = addSignal(0, PACKET_SIZE, createDomainSignal("2022-09-27T00:02:03+00:00"));
+
+    auto multi = MultiReader(signalsToList());
+
+    sig0.createAndSendPacket(0);
+    sig1.createAndSendPacket(0);
+
+    constexpr const SizeT SAMPLES = PACKET_SIZE * 2;
+
+    std::array<double[SAMPLES], NUM_SIGNALS> values{};
+    void* valuesPerSignal[NUM_SIGNALS]{values[0], values[1]};
+
+    using namespace std::chrono_literals;
+    constexpr auto SEND_DELAY = 200ms;
+
+    std::chrono::steady_clock::time_point sendTime;
+    std::thread thread([sig0, sig1, &sendTime, SEND_DELAY]
+    {
+        std::this_thread::sleep_for(SEND_DELAY);
+
+        sig0.createAndSendPacket(1);
+        sendTime = std::chrono::steady_clock::now();
+        sig1.createAndSendPacket(1);
+    });
+
+    SizeT count{SAMPLES};
+    multi.read(valuesPerSignal, &count, 10000u);
+
+    const auto end = std::chrono::steady_clock::now();
+
+    if (thread.joinable())
+        thread.join();
+
+    ASSERT_EQ(count, SAMPLES);
+
+    // The read must wait for the data and return as soon as the last signal receives it,
+    // not at the timeout
+    ASSERT_GE(end, sendTime);
+    ASSERT_LT(end - sendTime, 50ms);
+}
+
 TEST_F(MultiReaderTest, SignalStartDomainFrom0TimeoutExceeded)
 {
 	SKIP_TEST_MAC_CI;
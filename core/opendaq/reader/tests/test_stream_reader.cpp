@@ -10,6 +10,7 @@
 #include <opendaq/reader_factory.h>
 #include <opendaq/input_port_factory.h>
 #include <opendaq/dimension_factory.h>
+#include <array>
 #include <future>
 
 using namespace daq;
@@ -105,6 +106,69 @@ TYPED_TEST(StreamReaderTest, ReadOneSample)
     ASSERT_EQ(reader.getAvailableCount(), 0u);
 }
 
+TYPED_TEST(StreamReaderTest, ReadPostScaled)
+{
+    const auto scaling = LinearScaling(0.5, 10.0, SampleType::Int16, ScaledSampleType::Float64);
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64, nullptr, scaling));
+
+    auto reader = daq::StreamReader<TypeParam, ClockRange>(this->signal);
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 4);
+
+    const std::array<int16_t, 4> rawValues{-20, 0, 7, 200};
+    std::copy(rawValues.begin(), rawValues.end(), static_cast<int16_t*>(dataPacket.getRawData()));
+
+    this->sendPacket(dataPacket);
+
+    SizeT count{4};
+    TypeParam samples[4]{};
+    reader.read((TypeParam*) &samples, &count);
+
+    ASSERT_EQ(count, 4u);
+    for (SizeT i = 0; i < count; ++i)
+    {
+        const double scaled = 0.5 * rawValues[i] + 10.0;
+        if constexpr (IsTemplateOf<TypeParam, Complex_Number>::value || IsTemplateOf<TypeParam, RangeType>::value)
+        {
+            ASSERT_EQ(samples[i], TypeParam(typename TypeParam::Type(scaled)));
+        }
+        else
+        {
+            ASSERT_EQ(samples[i], TypeParam(scaled));
+        }
+    }
+}
+
+TYPED_TEST(StreamReaderTest, ReadPostScaledUnscaled)
+{
+    const auto scaling = LinearScaling(0.5, 10.0, SampleType::Int16, ScaledSampleType::Float64);
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64, nullptr, scaling));
+
+    auto reader = daq::StreamReader<TypeParam, ClockRange>(this->signal, ReadMode::Unscaled);
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), 2);
+
+    auto rawData = static_cast<int16_t*>(dataPacket.getRawData());
+    rawData[0] = 12;
+    rawData[1] = 100;
+
+    this->sendPacket(dataPacket);
+
+    SizeT count{2};
+    TypeParam samples[2]{};
+    reader.read((TypeParam*) &samples, &count);
+
+    ASSERT_EQ(count, 2u);
+    if constexpr (IsTemplateOf<TypeParam, Complex_Number>::value || IsTemplateOf<TypeParam, RangeType>::value)
+    {
+        ASSERT_EQ(samples[0], TypeParam(typename TypeParam::Type(12)));
+        ASSERT_EQ(samples[1], TypeParam(typename TypeParam::Type(100)));
+    }
+    else
+    {
+        ASSERT_EQ(samples[0], TypeParam(12));
+        ASSERT_EQ(samples[1], TypeParam(100));
+    }
+}
+
 TYPED_TEST(StreamReaderTest, ReadOneSampleWithTimeout)
 {
     this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
@@ -522,6 +586,88 @@ TYPED_TEST(StreamReaderTest, ReadValuesMoreThanAvailable)
     ASSERT_EQ(reader.getAvailableCount(), 0u);
 }
 
+TYPED_TEST(StreamReaderTest, ReadConvertedValues)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Int16));
+
+    auto reader = daq::StreamReader<TypeParam, ClockRange>(this->signal);
+
+    // Not a multiple of the vector width so the scalar tail is converted as well
+    const SizeT NUM_SAMPLES = 37;
+    auto dataPacket = DataPacket(this->signal.getDescriptor(), NUM_SAMPLES);
+    auto dataPtr = static_cast<int16_t*>(dataPacket.getData());
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        dataPtr[i] = static_cast<int16_t>(i * 3 - 50);
+
+    this->sendPacket(dataPacket);
+
+    SizeT count{NUM_SAMPLES};
+    TypeParam samples[NUM_SAMPLES]{};
+    reader.read((TypeParam*) &samples, &count);
+
+    ASSERT_EQ(count, NUM_SAMPLES);
+
+    for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+    {
+        if constexpr (IsTemplateOf<TypeParam, Complex_Number>::value || IsTemplateOf<TypeParam, RangeType>::value)
+            ASSERT_EQ(samples[i], TypeParam(typename TypeParam::Type(dataPtr[i])));
+        else
+            ASSERT_EQ(samples[i], (TypeParam) dataPtr[i]);
+    }
+}
+
+TYPED_TEST(StreamReaderTest, ReadConvertedValuesFromEachSampleType)
+{
+    const auto readConverted = [this](auto typeTag)
+    {
+        using TDataType = typename decltype(typeTag)::type;
+
+        this->signal.setDescriptor(setupDescriptor(SampleTypeFromType<TDataType>::SampleType));
+        auto reader = daq::StreamReader<TypeParam, ClockRange>(this->signal);
+
+        // Not a multiple of any vector width so the scalar tail is converted as well
+        const SizeT NUM_SAMPLES = 67;
+        auto dataPacket = DataPacket(this->signal.getDescriptor(), NUM_SAMPLES);
+        auto dataPtr = static_cast<TDataType*>(dataPacket.getData());
+        for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        {
+            // integers cover the full range of the type to exercise truncation and sign extension,
+            // floating point values stay representable in every read type
+            if constexpr (std::is_integral_v<TDataType>)
+                dataPtr[i] = static_cast<TDataType>(i * 0x9E3779B97F4A7C15ull);
+            else
+                dataPtr[i] = static_cast<TDataType>(i * 1.5);
+        }
+
+        this->sendPacket(dataPacket);
+
+        SizeT count{NUM_SAMPLES};
+        TypeParam samples[NUM_SAMPLES]{};
+        reader.read((TypeParam*) &samples, &count);
+
+        ASSERT_EQ(count, NUM_SAMPLES);
+
+        for (SizeT i = 0; i < NUM_SAMPLES; ++i)
+        {
+            if constexpr (IsTemplateOf<TypeParam, Complex_Number>::value || IsTemplateOf<TypeParam, RangeType>::value)
+                ASSERT_EQ(samples[i], TypeParam(typename TypeParam::Type(dataPtr[i])));
+            else
+                ASSERT_EQ(samples[i], (TypeParam) dataPtr[i]);
+        }
+    };
+
+    readConverted(std::common_type<int8_t>());
+    readConverted(std::common_type<uint8_t>());
+    readConverted(std::common_type<int16_t>());
+    readConverted(std::common_type<uint16_t>());
+    readConverted(std::common_type<int32_t>());
+    readConverted(std::common_type<uint32_t>());
+    readConverted(std::common_type<int64_t>());
+    readConverted(std::common_type<uint64_t>());
+    readConverted(std::common_type<float>());
+    readConverted(std::common_type<double>());
+}
+
 TYPED_TEST(StreamReaderTest, DescriptorChangedConvertible)
 {
     this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
@@ -802,6 +948,38 @@ TYPED_TEST(StreamReaderTest, ReadUndefinedWithWithDomainFromPacket)
     ASSERT_EQ(reader.getDomainReadType(), SampleType::RangeInt64);
 }
 
+TYPED_TEST(StreamReaderTest, ReadLinearDomainInParts)
+{
+    this->signal.setDescriptor(setupDescriptor(SampleType::Float64));
+
+    auto reader = daq::StreamReader<double, Int>(this->signal);
+
+    auto domainPacket = DataPacket(setupDescriptor(SampleType::Int64, LinearDataRule(10, 5), nullptr), 4, 1000);
+    auto dataPacket = DataPacketWithDomain(domainPacket, this->signal.getDescriptor(), 4);
+    auto dataPtr = static_cast<double*>(dataPacket.getData());
+    for (SizeT i = 0; i < 4; ++i)
+        dataPtr[i] = static_cast<double>(i);
+
+    this->sendPacket(dataPacket);
+
+    SizeT count{2};
+    double samples[2]{};
+    Int domain[2]{};
+    reader.readWithDomain(&samples, &domain, &count);
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(domain[0], 1005);
+    ASSERT_EQ(domain[1], 1015);
+
+    count = 2;
+    reader.readWithDomain(&samples, &domain, &count);
+
+    ASSERT_EQ(count, 2u);
+    ASSERT_EQ(samples[1], 3.0);
+    ASSERT_EQ(domain[0], 1025);
+    ASSERT_EQ(domain[1], 1035);
+}
+
 TYPED_TEST(StreamReaderTest, ReadVoid)
 {
     this->signal.setDescriptor(setupDescriptor(SampleTypeFromType<TypeParam>::SampleType));
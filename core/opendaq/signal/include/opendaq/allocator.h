@@ -80,6 +80,21 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
 )
 #endif
 
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IAllocator,
+    SizeT, maxPooledBytes
+)
+
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, RingAllocator,
+    IAllocator,
+    SizeT, capacity,
+    SizeT, timeoutMs,
+    Bool, useHugePages,
+    Bool, heapFallback
+)
+
 OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     LIBRARY_FACTORY, ExternalAllocator,
     IAllocator,
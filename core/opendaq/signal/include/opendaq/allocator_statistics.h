@@ -0,0 +1,61 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_utility
+ * @addtogroup opendaq_allocator Allocator
+ * @{
+ */
+
+/*!
+ * @brief Provides the usage statistics of a pooling allocator.
+ *
+ * An allocation is a hit if it was served from memory previously released to the pool, and a miss
+ * if the allocator had to request new memory from the system.
+ */
+DECLARE_OPENDAQ_INTERFACE(IAllocatorStatistics, IBaseObject)
+{
+    /*!
+     * @brief Gets the number of allocations served from the pool.
+     * @param[out] count The number of pool hits since the allocator was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getHitCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the number of allocations that required new memory from the system.
+     * @param[out] count The number of pool misses since the allocator was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getMissCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the amount of released memory currently held by the pool for reuse.
+     * @param[out] bytes The number of bytes held by the pool.
+     */
+    virtual ErrCode INTERFACE_FUNC getPooledBytes(SizeT* bytes) = 0;
+};
+/*!@}*/
+
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PacketObjectPoolStatistics,
+    IAllocatorStatistics
+)
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,385 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/connection.h>
+#include <opendaq/packet.h>
+#include <opendaq/utility_sync.h>
+#include <coretypes/common.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief Fixed-capacity ring buffer of packets used by bounded connections.
+ *
+ * The producer only ever writes the tail index and the consumer only ever writes the head index, so
+ * a single producer and a single consumer never wait on each other. Concurrent producers (or concurrent
+ * consumers) are serialized among themselves by a spin lock that is uncontended in the single-producer,
+ * single-consumer case. The only time the producer touches the consumer side is when evicting the oldest
+ * packet under the `DropOldest` policy. Producers blocked by the `BlockProducer` policy wait on a condition
+ * variable without holding the spin lock.
+ *
+ * The queue holds a reference to each stored packet. It also keeps running totals of enqueued and dequeued
+ * samples, together with the positions of queued data-descriptor-changed events, so that the number of
+ * available samples can be obtained without walking the queue. Each stored packet is stamped with the time
+ * it was enqueued, so the consumer can tell how long it waited.
+ */
+class BoundedPacketQueue
+{
+public:
+    BoundedPacketQueue(SizeT capacity, QueueOverflowPolicy policy);
+    ~BoundedPacketQueue();
+
+    BoundedPacketQueue(const BoundedPacketQueue&) = delete;
+    BoundedPacketQueue& operator=(const BoundedPacketQueue&) = delete;
+
+    /*!
+     * @brief Stores the packet at the back of the queue, applying the overflow policy if the queue is full.
+     * @param packet The packet to store. A reference is added if the packet is stored.
+     * @param sampleCount The number of samples in the packet, 0 for non-data packets.
+     * @param descriptorChanged True if the packet is a data-descriptor-changed event.
+     * @param keepWaiting Polled periodically while blocked with the `BlockProducer` policy. When it returns
+     * false, the packet is discarded instead.
+     * @returns False if the packet was discarded.
+     */
+    template <typename KeepWaiting>
+    bool push(IPacket* packet, SizeT sampleCount, bool descriptorChanged, KeepWaiting&& keepWaiting);
+
+    /*!
+     * @brief Removes the packet at the front of the queue.
+     * @param[out] enqueueTime If not null, receives the time at which the removed packet was enqueued.
+     * @returns The removed packet with its reference transferred to the caller, or `nullptr` if empty.
+     */
+    IPacket* pop(std::chrono::steady_clock::time_point* enqueueTime = nullptr);
+
+    /*!
+     * @brief Returns the packet at the front of the queue with an added reference, or `nullptr` if empty.
+     */
+    IPacket* peek();
+
+    /*!
+     * @brief Gets the number of samples in all queued data packets.
+     */
+    SizeT getAvailableSamples() const;
+
+    /*!
+     * @brief Gets the number of samples queued before the first data-descriptor-changed event.
+     *
+     * Can be called from any thread, but briefly excludes consumers while doing so.
+     */
+    SizeT getSamplesUntilNextDescriptor() const;
+
+    SizeT size() const;
+    SizeT getCapacity() const;
+    QueueOverflowPolicy getPolicy() const;
+    SizeT getDroppedCount() const;
+    SizeT getHighWaterMark() const;
+
+private:
+    struct Slot
+    {
+        std::atomic<IPacket*> packet{nullptr};
+        SizeT sampleCount{0};
+        bool descriptorChanged{false};
+        std::chrono::steady_clock::time_point enqueueTime;
+    };
+
+    static constexpr std::size_t CacheLineSize = 64;
+    static constexpr std::chrono::milliseconds BlockPollInterval{50};
+
+    template <typename KeepWaiting>
+    bool waitForSpace(UInt tailIndex, KeepWaiting& keepWaiting);
+    void store(UInt tailIndex, IPacket* packet, SizeT sampleCount, bool descriptorChanged);
+    IPacket* evictOldest(UInt tailIndex);
+    IPacket* takeFront(UInt headIndex);
+    void notifyProducer();
+
+    Slot& slot(UInt index);
+
+    const SizeT capacity;
+    const QueueOverflowPolicy policy;
+    std::unique_ptr<Slot[]> slots;
+
+    // Cumulative enqueued-sample count at each queued descriptor change. There can never be more
+    // descriptor changes than packets in the queue, so the ring has the same capacity.
+    std::unique_ptr<UInt[]> descriptorBoundaries;
+
+    alignas(CacheLineSize) std::atomic<UInt> head{0};
+    std::atomic<UInt> boundaryHead{0};
+    std::atomic<UInt> dequeuedSamples{0};
+    mutable SpinLock consumerLock;
+
+    alignas(CacheLineSize) std::atomic<UInt> tail{0};
+    std::atomic<UInt> boundaryTail{0};
+    std::atomic<UInt> enqueuedSamples{0};
+    SpinLock producerLock;
+    std::atomic<SizeT> dropped{0};
+    std::atomic<SizeT> highWaterMark{0};
+
+    alignas(CacheLineSize) std::atomic<SizeT> waitingProducers{0};
+    std::mutex waitMutex;
+    std::condition_variable notFull;
+};
+
+inline BoundedPacketQueue::BoundedPacketQueue(SizeT capacity, QueueOverflowPolicy policy)
+    : capacity(capacity)
+    , policy(policy)
+    , slots(std::make_unique<Slot[]>(capacity))
+    , descriptorBoundaries(std::make_unique<UInt[]>(capacity))
+{
+}
+
+inline BoundedPacketQueue::~BoundedPacketQueue()
+{
+    while (IPacket* packet = pop())
+        packet->releaseRef();
+}
+
+template <typename KeepWaiting>
+bool BoundedPacketQueue::push(IPacket* packet, SizeT sampleCount, bool descriptorChanged, KeepWaiting&& keepWaiting)
+{
+    IPacket* evicted = nullptr;
+    for (;;)
+    {
+        UInt t;
+        {
+            std::lock_guard guard(producerLock);
+
+            t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) >= capacity)
+            {
+                switch (policy)
+                {
+                    case QueueOverflowPolicy::DropOldest:
+                        evicted = evictOldest(t);
+                        break;
+                    case QueueOverflowPolicy::DropNewest:
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    case QueueOverflowPolicy::BlockProducer:
+                        break;
+                }
+            }
+
+            if (t - head.load(std::memory_order_acquire) < capacity)
+            {
+                store(t, packet, sampleCount, descriptorChanged);
+                break;
+            }
+        }
+
+        // Waits without the producer lock, so other producers block on the condition variable as well instead
+        // of spinning on the lock. Another producer may take the freed slot first, so the check is repeated.
+        if (!waitForSpace(t, keepWaiting))
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+    }
+
+    // Release outside of the producer lock, the packet destructor may run here
+    if (evicted != nullptr)
+        evicted->releaseRef();
+
+    return true;
+}
+
+inline void BoundedPacketQueue::store(UInt tailIndex, IPacket* packet, SizeT sampleCount, bool descriptorChanged)
+{
+    const UInt samples = enqueuedSamples.load(std::memory_order_relaxed);
+    if (descriptorChanged)
+    {
+        // Published before the event itself, so the consumer always finds it when dequeuing the event
+        const UInt bt = boundaryTail.load(std::memory_order_relaxed);
+        descriptorBoundaries[bt % capacity] = samples;
+        boundaryTail.store(bt + 1, std::memory_order_release);
+    }
+
+    packet->addRef();
+    Slot& s = slot(tailIndex);
+    s.sampleCount = sampleCount;
+    s.descriptorChanged = descriptorChanged;
+    s.enqueueTime = std::chrono::steady_clock::now();
+    s.packet.store(packet, std::memory_order_relaxed);
+    tail.store(tailIndex + 1, std::memory_order_release);
+
+    // Counted only after the packet is visible, so counted samples can always be dequeued
+    if (sampleCount != 0)
+        enqueuedSamples.store(samples + sampleCount, std::memory_order_release);
+
+    const SizeT depth = tailIndex + 1 - head.load(std::memory_order_relaxed);
+    if (depth > highWaterMark.load(std::memory_order_relaxed))
+        highWaterMark.store(depth, std::memory_order_relaxed);
+}
+
+inline IPacket* BoundedPacketQueue::evictOldest(UInt tailIndex)
+{
+    std::lock_guard guard(consumerLock);
+
+    // The consumer may have made room in the meantime
+    const UInt h = head.load(std::memory_order_relaxed);
+    if (tailIndex - h < capacity)
+        return nullptr;
+
+    dropped.fetch_add(1, std::memory_order_relaxed);
+    return takeFront(h);
+}
+
+inline IPacket* BoundedPacketQueue::takeFront(UInt headIndex)
+{
+    Slot& s = slot(headIndex);
+    IPacket* packet = s.packet.exchange(nullptr, std::memory_order_relaxed);
+
+    if (s.sampleCount != 0)
+        dequeuedSamples.store(dequeuedSamples.load(std::memory_order_relaxed) + s.sampleCount, std::memory_order_release);
+    if (s.descriptorChanged)
+        boundaryHead.store(boundaryHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+    head.store(headIndex + 1, std::memory_order_release);
+    return packet;
+}
+
+template <typename KeepWaiting>
+bool BoundedPacketQueue::waitForSpace(UInt tailIndex, KeepWaiting& keepWaiting)
+{
+    std::unique_lock lock(waitMutex);
+    waitingProducers.fetch_add(1);
+
+    // The tail index may be stale by now and the head may already have passed it
+    bool hasSpace = true;
+    while (head.load(std::memory_order_acquire) + capacity <= tailIndex)
+    {
+        if (!keepWaiting())
+        {
+            hasSpace = false;
+            break;
+        }
+
+        // Timed wait guards against a notification racing with the counter being incremented
+        notFull.wait_for(lock, BlockPollInterval);
+    }
+
+    waitingProducers.fetch_sub(1);
+    return hasSpace;
+}
+
+inline void BoundedPacketQueue::notifyProducer()
+{
+    if (policy == QueueOverflowPolicy::BlockProducer && waitingProducers.load() != 0)
+    {
+        std::lock_guard lock(waitMutex);
+        notFull.notify_all();
+    }
+}
+
+inline IPacket* BoundedPacketQueue::pop(std::chrono::steady_clock::time_point* enqueueTime)
+{
+    IPacket* packet;
+    {
+        std::lock_guard guard(consumerLock);
+
+        const UInt h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire))
+            return nullptr;
+
+        if (enqueueTime != nullptr)
+            *enqueueTime = slot(h).enqueueTime;
+        packet = takeFront(h);
+    }
+
+    notifyProducer();
+    return packet;
+}
+
+inline IPacket* BoundedPacketQueue::peek()
+{
+    std::lock_guard guard(consumerLock);
+
+    const UInt h = head.load(std::memory_order_relaxed);
+    if (h == tail.load(std::memory_order_acquire))
+        return nullptr;
+
+    IPacket* packet = slot(h).packet.load(std::memory_order_relaxed);
+    packet->addRef();
+    return packet;
+}
+
+inline SizeT BoundedPacketQueue::getAvailableSamples() const
+{
+    // Dequeued must be read first, so that the enqueued total can never be behind it
+    const UInt dequeued = dequeuedSamples.load(std::memory_order_acquire);
+    return enqueuedSamples.load(std::memory_order_acquire) - dequeued;
+}
+
+inline SizeT BoundedPacketQueue::getSamplesUntilNextDescriptor() const
+{
+    // The consumer side must not advance while the boundary is read. The producer can only reuse the boundary
+    // slot after the descriptor change in it was dequeued, so the slot stays valid while the lock is held.
+    std::lock_guard guard(consumerLock);
+
+    const UInt dequeued = dequeuedSamples.load(std::memory_order_acquire);
+
+    // The enqueued total is read before the boundaries; if no descriptor change is queued at this point,
+    // none was queued when the total was read either, so all of the counted samples precede it.
+    const UInt enqueued = enqueuedSamples.load(std::memory_order_acquire);
+
+    const UInt bh = boundaryHead.load(std::memory_order_acquire);
+    if (bh == boundaryTail.load(std::memory_order_acquire))
+        return enqueued - dequeued;
+
+    return descriptorBoundaries[bh % capacity] - dequeued;
+}
+
+inline SizeT BoundedPacketQueue::size() const
+{
+    // Head must be read first, so that the tail can never be behind it
+    const UInt h = head.load(std::memory_order_acquire);
+    return tail.load(std::memory_order_acquire) - h;
+}
+
+inline SizeT BoundedPacketQueue::getCapacity() const
+{
+    return capacity;
+}
+
+inline QueueOverflowPolicy BoundedPacketQueue::getPolicy() const
+{
+    return policy;
+}
+
+inline SizeT BoundedPacketQueue::getDroppedCount() const
+{
+    return dropped.load(std::memory_order_relaxed);
+}
+
+inline SizeT BoundedPacketQueue::getHighWaterMark() const
+{
+    return highWaterMark.load(std::memory_order_relaxed);
+}
+
+inline BoundedPacketQueue::Slot& BoundedPacketQueue::slot(UInt index)
+{
+    return slots[index % capacity];
+}
+
+END_NAMESPACE_OPENDAQ
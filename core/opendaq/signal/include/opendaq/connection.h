@@ -22,6 +22,18 @@
 
 BEGIN_NAMESPACE_OPENDAQ
 
+/*!
+ * @brief Determines how a bounded connection queue behaves when a packet is enqueued while the queue is full.
+ */
+enum class QueueOverflowPolicy
+{
+    DropOldest = 0, ///< Remove the packet at the front of the queue to make room for the new one.
+    DropNewest,     ///< Discard the packet being enqueued.
+    BlockProducer,  ///< Block the enqueuing thread until the consumer makes room in the queue. Not supported
+                    ///< for input ports notified on the same thread, as the producer would wait on itself.
+    Unbounded       ///< The connection queue has no capacity limit and never overflows.
+};
+
 /*#
  * [interfaceSmartPtr(IInputPort, ObjectPtr<IInputPort>, "")]
  * [interfaceSmartPtr(ISignal, ObjectPtr<ISignal>, "")]
@@ -114,6 +126,15 @@ DECLARE_OPENDAQ_INTERFACE(IConnection, IBaseObject)
      * on remote devices.
      */
     virtual ErrCode INTERFACE_FUNC isRemote(Bool* remote) = 0;
+
+    // [elementType(packets, IPacket)]
+    /*!
+     * @brief Places multiple packets at the back of the queue.
+     * @param packets The packets to be enqueued, in order.
+     *
+     * The packets are enqueued under a single lock acquisition and the listener is notified once for the whole batch.
+     */
+    virtual ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) = 0;
 };
 /*!@}*/
 
@@ -124,4 +145,13 @@ OPENDAQ_DECLARE_CLASS_FACTORY(
     IContext*, context
 )
 
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, BoundedConnection, IConnection,
+    IInputPort*, inputPort,
+    ISignal*, signal,
+    IContext*, context,
+    SizeT, capacity,
+    QueueOverflowPolicy, overflowPolicy
+)
+
 END_NAMESPACE_OPENDAQ
@@ -39,6 +39,28 @@ inline ConnectionPtr Connection(InputPortPtr inputPort, SignalPtr signal, Contex
     ConnectionPtr obj(Connection_Create(inputPort, signal, context));
     return obj;
 }
+
+/*!
+ * @brief Creates a Connection object that stores packets in a fixed-size ring buffer instead of an unbounded queue.
+ * @param inputPort The input port to which the connection leads.
+ * @param signal The signal that is to be connected to an input port.
+ * @param context The Context. Most often provided by the Instance.
+ * @param capacity The maximum number of packets held by the connection. Must be greater than 0.
+ * @param overflowPolicy Determines what happens when a packet is enqueued while the connection is full.
+ *
+ * Enqueue and dequeue operations of a bounded connection do not take a lock when one thread sends packets and
+ * another one reads them. The number of dropped packets and the queue high-water mark can be obtained through
+ * the `IConnectionStatistics` interface.
+ */
+inline ConnectionPtr BoundedConnection(InputPortPtr inputPort,
+                                       SignalPtr signal,
+                                       ContextPtr context,
+                                       SizeT capacity,
+                                       QueueOverflowPolicy overflowPolicy = QueueOverflowPolicy::DropOldest)
+{
+    ConnectionPtr obj(BoundedConnection_Create(inputPort, signal, context, capacity, overflowPolicy));
+    return obj;
+}
 /*!@}*/
 
 END_NAMESPACE_OPENDAQ
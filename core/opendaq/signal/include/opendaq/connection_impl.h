@@ -16,20 +16,25 @@
 
 #pragma once
 #include <opendaq/connection.h>
+#include <opendaq/connection_statistics.h>
+#include <opendaq/bounded_packet_queue.h>
+#include <opendaq/metric_counters.h>
 #include <opendaq/input_port_config_ptr.h>
 #include <opendaq/context_ptr.h>
 #include <coretypes/intfs.h>
+#include <coretypes/listobject_factory.h>
 #include <coretypes/weakrefobj.h>
 
 #ifdef OPENDAQ_THREAD_SAFE
     #include <mutex>
 #endif
 
+#include <memory>
 #include <queue>
 
 BEGIN_NAMESPACE_OPENDAQ
 
-class ConnectionImpl : public ImplementationOfWeak<IConnection>
+class ConnectionImpl : public ImplementationOfWeak<IConnection, IConnectionStatistics>
 {
 public:
     explicit ConnectionImpl(
@@ -38,6 +43,14 @@ public:
         ContextPtr context
     );
 
+    explicit ConnectionImpl(
+        const InputPortPtr& port,
+        const SignalPtr& signal,
+        ContextPtr context,
+        SizeT capacity,
+        QueueOverflowPolicy overflowPolicy
+    );
+
     ErrCode INTERFACE_FUNC enqueue(IPacket* packet) override;
     ErrCode INTERFACE_FUNC enqueueOnThisThread(IPacket* packet) override;
     ErrCode INTERFACE_FUNC dequeue(IPacket** packet) override;
@@ -50,6 +63,15 @@ public:
     ErrCode INTERFACE_FUNC getSamplesUntilNextDescriptor(SizeT* samples) override;
 
     ErrCode INTERFACE_FUNC isRemote(Bool* remote) override;
+    ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) override;
+
+    // IConnectionStatistics
+    ErrCode INTERFACE_FUNC getQueueCapacity(SizeT* capacity) override;
+    ErrCode INTERFACE_FUNC getOverflowPolicy(QueueOverflowPolicy* policy) override;
+    ErrCode INTERFACE_FUNC getDroppedPacketCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getHighWaterMark(SizeT* highWaterMark) override;
+    ErrCode INTERFACE_FUNC getQueueLatencyHistogram(IList** bucketCounts) override;
+    ErrCode INTERFACE_FUNC getLatePacketCount(SizeT* count) override;
 
     [[nodiscard]] const std::deque<PacketPtr>& getPackets() const noexcept;
 
@@ -69,9 +91,26 @@ public:
 #endif
 
 private:
+    static void getSampleAccounting(IPacket* packet, SizeT& sampleCount, bool& descriptorChanged);
+
+    bool enqueueInternal(IPacket* packet);
+    bool enqueueMultipleInternal(const ListPtr<IPacket>& packets);
+    bool isAttachedToPort() const;
+
     InputPortConfigPtr port;
     WeakRefPtr<ISignal> signalRef;
     ContextPtr context;
+    std::unique_ptr<BoundedPacketQueue> boundedQueue;
+    SizeT highWaterMark;
+
+    // Running sample totals of the unbounded queue. `descriptorSegments` holds the number of queued samples
+    // before the first data-descriptor-changed event, followed by the number of samples after each queued one.
+    SizeT availableSamples;
+    std::deque<SizeT> descriptorSegments;
+
+    // Enqueue time of each packet in the unbounded queue, in the same order as `packets`
+    std::deque<std::chrono::steady_clock::time_point> enqueueTimes;
+    LatencyHistogram queueLatency;
 
 #ifdef OPENDAQ_THREAD_SAFE
     mutable std::mutex mutex;
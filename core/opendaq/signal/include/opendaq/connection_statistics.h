@@ -0,0 +1,84 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/connection.h>
+#include <coretypes/listobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_signal_path
+ * @addtogroup opendaq_connection Connection
+ * @{
+ */
+
+/*!
+ * @brief Provides the queue configuration and queue statistics of a Connection.
+ *
+ * Connections created with the `Connection` factory hold an unbounded queue, report a capacity of 0
+ * and never drop packets. Connections created with the `BoundedConnection` factory hold at most
+ * `capacity` packets and handle overflow according to their overflow policy.
+ *
+ * Each dequeued packet is timed from the moment it was enqueued. The wait times are collected in a histogram
+ * with power-of-two microsecond buckets: bucket 0 counts packets that waited less than 1 us, bucket `i` counts
+ * packets that waited between 2^(i-1) and 2^i us, and the last bucket counts packets that waited at least
+ * 2^20 us (about 1 s). Packets in the last bucket are reported as late. All counters are kept with relaxed
+ * atomics and are always enabled.
+ */
+DECLARE_OPENDAQ_INTERFACE(IConnectionStatistics, IBaseObject)
+{
+    /*!
+     * @brief Gets the maximum number of packets the connection can hold.
+     * @param[out] capacity The capacity of the queue, or 0 if the queue is unbounded.
+     */
+    virtual ErrCode INTERFACE_FUNC getQueueCapacity(SizeT* capacity) = 0;
+
+    /*!
+     * @brief Gets the policy used when a packet is enqueued while the queue is full.
+     * @param[out] policy The overflow policy, or `Unbounded` if the queue has no capacity limit.
+     */
+    virtual ErrCode INTERFACE_FUNC getOverflowPolicy(QueueOverflowPolicy* policy) = 0;
+
+    /*!
+     * @brief Gets the number of packets that were discarded due to the queue being full.
+     * @param[out] count The number of dropped packets since the connection was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getDroppedPacketCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the largest number of packets that were queued at the same time.
+     * @param[out] highWaterMark The queue high-water mark since the connection was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getHighWaterMark(SizeT* highWaterMark) = 0;
+
+    // [elementType(bucketCounts, IInteger)]
+    /*!
+     * @brief Gets the histogram of the time dequeued packets spent in the queue.
+     * @param[out] bucketCounts The number of packets in each power-of-two microsecond bucket.
+     */
+    virtual ErrCode INTERFACE_FUNC getQueueLatencyHistogram(IList** bucketCounts) = 0;
+
+    /*!
+     * @brief Gets the number of dequeued packets that waited in the queue for about 1 s or longer.
+     * @param[out] count The number of late packets since the connection was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getLatePacketCount(SizeT* count) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -172,4 +172,28 @@ OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
     IAllocator*, allocator
 )
 
+/*!
+ * @brief Creates a Data packet whose scaled or rule-calculated data is allocated with a given allocator.
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ * @param allocator Optional allocator that allocates memory for packets.
+ * @param scaledDataAllocator Optional allocator that allocates the buffer returned by `getData` when
+ * the packet data is post-scaled or calculated from the Data rule.
+ *
+ * The scaled data buffer is allocated and filled the first time `getData` is called. If the caller does
+ * not pass a scaled data allocator, the buffer is allocated on the heap.
+ */
+OPENDAQ_DECLARE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, DataPacketWithScaledDataAllocator, IDataPacket,
+    IDataPacket*, domainPacket,
+    IDataDescriptor*, descriptor,
+    SizeT, sampleCount,
+    INumber*, offset,
+    IAllocator*, allocator,
+    IAllocator*, scaledDataAllocator
+)
+
 END_NAMESPACE_OPENDAQ
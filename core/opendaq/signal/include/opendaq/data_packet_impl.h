@@ -20,10 +20,12 @@
 #include <opendaq/data_descriptor_ptr.h>
 #include <opendaq/data_rule_calc_private.h>
 #include <opendaq/generic_data_packet_impl.h>
+#include <opendaq/packet_object_pool.h>
 #include <opendaq/range_factory.h>
 #include <opendaq/sample_type_traits.h>
 #include <opendaq/scaling_calc_private.h>
 #include <opendaq/signal_exceptions.h>
+#include <atomic>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -37,10 +39,21 @@ public:
                             const DataDescriptorPtr& descriptor,
                             SizeT sampleCount,
                             const NumberPtr& offset,
-                            AllocatorPtr allocator);
+                            AllocatorPtr allocator,
+                            AllocatorPtr scaledDataAllocator = nullptr);
     explicit DataPacketImpl(const DataDescriptorPtr& descriptor, SizeT sampleCount, const NumberPtr& offset, AllocatorPtr allocator);
     ~DataPacketImpl() override;
 
+    static void* operator new(std::size_t size)
+    {
+        return PacketObjectPool::allocate(size);
+    }
+
+    static void operator delete(void* address, std::size_t size)
+    {
+        PacketObjectPool::release(address, size);
+    }
+
     ErrCode INTERFACE_FUNC getDataDescriptor(IDataDescriptor** descriptor) override;
     ErrCode INTERFACE_FUNC getSampleCount(SizeT* sampleCount) override;
     ErrCode INTERFACE_FUNC getOffset(INumber** offset) override;
@@ -53,23 +66,34 @@ public:
     ErrCode INTERFACE_FUNC equals(IBaseObject* other, Bool* equals) const override;
 
 private:
+    // Where the values returned by getData come from
+    enum class DataSource : uint8_t
+    {
+        Raw,
+        Scaling,
+        Rule
+    };
+
     bool isDataEqual(const DataPacketPtr& dataPacket) const;
 
+    void* materializeData();
+    void* allocateScaledData() const;
+    void freeScaledData(void* address) const;
+
     AllocatorPtr allocator;
+    AllocatorPtr scaledDataAllocator;
     DataDescriptorPtr descriptor;
     SizeT sampleCount;
     NumberPtr offset = nullptr;
-    SizeT sampleSize, dataSize;
-    SizeT rawSampleSize, rawDataSize;
+    SizeT dataSize;
+    SizeT rawDataSize;
 
     void* data;
-    void* scaledData;
 
-    std::mutex readLock;
+    // Scaled or rule-calculated data, published once by the first getData call
+    std::atomic<void*> scaledData;
 
-    bool hasScalingCalc;
-    bool hasDataRuleCalc;
-    bool hasRawDataOnly;
+    DataSource dataSource;
 };
 
 template <typename TInterface>
@@ -77,24 +101,23 @@ DataPacketImpl<TInterface>::DataPacketImpl(const DataPacketPtr& domainPacket,
                                            const DataDescriptorPtr& descriptor,
                                            SizeT sampleCount,
                                            const NumberPtr& offset,
-                                           AllocatorPtr allocator)
+                                           AllocatorPtr allocator,
+                                           AllocatorPtr scaledDataAllocator)
     : GenericDataPacketImpl<TInterface>(domainPacket)
     , allocator(std::move(allocator))
+    , scaledDataAllocator(std::move(scaledDataAllocator))
     , descriptor(descriptor)
     , sampleCount(sampleCount)
     , offset(offset)
-    , hasScalingCalc(false)
-    , hasDataRuleCalc(false)
-    , hasRawDataOnly(true)
+    , data(nullptr)
+    , scaledData(nullptr)
+    , dataSource(DataSource::Raw)
 {
-    scaledData = nullptr;
-    data = nullptr;
-
     if (!descriptor.assigned())
         throw ArgumentNullException("Data descriptor in packet is null.");
 
-    sampleSize = descriptor.getSampleSize();
-    rawSampleSize = descriptor.getRawSampleSize();
+    const SizeT sampleSize = descriptor.getSampleSize();
+    const SizeT rawSampleSize = descriptor.getRawSampleSize();
     dataSize = sampleCount * sampleSize;
     rawDataSize = sampleCount * rawSampleSize;
 
@@ -114,12 +137,11 @@ DataPacketImpl<TInterface>::DataPacketImpl(const DataPacketPtr& domainPacket,
 
     const auto ruleType = descriptor.getRule().getType();
 
-    if (ruleType == DataRuleType::Constant || (ruleType == DataRuleType::Linear && this->offset.assigned()))
-        hasDataRuleCalc = descriptor.asPtr<IDataRuleCalcPrivate>(false)->hasDataRuleCalc();
-
-    hasScalingCalc = descriptor.asPtr<IScalingCalcPrivate>(false)->hasScalingCalc();
-
-    hasRawDataOnly = !hasScalingCalc && !hasDataRuleCalc;
+    if (descriptor.asPtr<IScalingCalcPrivate>(false)->hasScalingCalc())
+        dataSource = DataSource::Scaling;
+    else if ((ruleType == DataRuleType::Constant || (ruleType == DataRuleType::Linear && this->offset.assigned())) &&
+             descriptor.asPtr<IDataRuleCalcPrivate>(false)->hasDataRuleCalc())
+        dataSource = DataSource::Rule;
 }
 
 template <typename TInterface>
@@ -142,7 +164,8 @@ DataPacketImpl<TInterface>::~DataPacketImpl()
     {
         std::free(data);
     }
-    std::free(scaledData);
+
+    freeScaledData(scaledData.load(std::memory_order_acquire));
 }
 
 template <typename TInterface>
@@ -186,42 +209,74 @@ ErrCode DataPacketImpl<TInterface>::getData(void** address)
 {
     OPENDAQ_PARAM_NOT_NULL(address);
 
-    if (hasRawDataOnly)
+    if (dataSource == DataSource::Raw)
     {
         *address = data;
         return OPENDAQ_SUCCESS;
     }
 
-    readLock.lock();
+    *address = scaledData.load(std::memory_order_acquire);
+    if (*address != nullptr || sampleCount == 0)
+        return OPENDAQ_SUCCESS;
+
+    return daqTry(
+        [&]()
+        {
+            *address = materializeData();
+            return OPENDAQ_SUCCESS;
+        });
+}
 
-    if (scaledData)
+// Computes the data into a new buffer and publishes it with a compare-exchange. Threads that race on the
+// first getData call each compute a buffer; the ones that lose release theirs and return the published one.
+template <typename TInterface>
+void* DataPacketImpl<TInterface>::materializeData()
+{
+    void* buffer = allocateScaledData();
+
+    try
     {
-        *address = scaledData;
+        if (dataSource == DataSource::Scaling)
+            descriptor.asPtr<IScalingCalcPrivate>(false)->scaleData(data, sampleCount, &buffer);
+        else
+            descriptor.asPtr<IDataRuleCalcPrivate>(false)->calculateRule(offset, sampleCount, &buffer);
     }
-    else
+    catch (...)
     {
-        if (sampleCount == 0)
-            *address = nullptr;
-        else
-            daqTry(
-                [&]()
-                {
-                    if (hasScalingCalc)
-                    {
-                        scaledData = descriptor.asPtr<IScalingCalcPrivate>(false)->scaleData(data, sampleCount);
-                    }
-                    else if (hasDataRuleCalc)
-                    {
-                        scaledData = descriptor.asPtr<IDataRuleCalcPrivate>(false)->calculateRule(offset, sampleCount);
-                    }
-
-                    *address = scaledData;
-                    return OPENDAQ_SUCCESS;
-                });
+        freeScaledData(buffer);
+        throw;
     }
 
-    readLock.unlock();
-    return OPENDAQ_SUCCESS;
+    void* published = nullptr;
+    if (scaledData.compare_exchange_strong(published, buffer, std::memory_order_acq_rel, std::memory_order_acquire))
+        return buffer;
+
+    freeScaledData(buffer);
+    return published;
+}
+
+template <typename TInterface>
+void* DataPacketImpl<TInterface>::allocateScaledData() const
+{
+    void* buffer;
+    if (scaledDataAllocator.assigned())
+        buffer = scaledDataAllocator.allocate(descriptor, dataSize, dataSize / sampleCount);
+    else
+        buffer = std::malloc(dataSize);
+
+    if (buffer == nullptr)
+        throw NoMemoryException("Memory allocation failed.");
+
+    return buffer;
+}
+
+template <typename TInterface>
+void DataPacketImpl<TInterface>::freeScaledData(void* address) const
+{
+    if (scaledDataAllocator.assigned())
+        scaledDataAllocator.free(address);
+    else
+        std::free(address);
 }
 
 template <typename TInterface>
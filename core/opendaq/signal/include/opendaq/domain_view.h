@@ -0,0 +1,146 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/data_packet_ptr.h>
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/data_rule_ptr.h>
+#include <opendaq/sample_type_traits.h>
+#include <opendaq/signal_exceptions.h>
+#include <algorithm>
+#include <type_traits>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_packets
+ * @brief Read-only view of the values of a domain packet.
+ *
+ * Domain packets with a linear rule and an offset have their values computed on access, as
+ * <em>offset + start + index * delta</em>, so that the packet never allocates and fills its data buffer.
+ * Values of other domain packets are read from the packet's data. The view type must match the
+ * domain sample type; it keeps the packet alive for as long as it exists.
+ */
+template <typename T>
+class DomainView
+{
+    static_assert(std::is_arithmetic_v<T>, "Domain views are only supported for numeric sample types");
+
+public:
+    explicit DomainView(const DataPacketPtr& domainPacket)
+        : packet(domainPacket)
+        , sampleCount(domainPacket.getSampleCount())
+    {
+        const auto descriptor = domainPacket.getDataDescriptor();
+        if (getSampleSize(descriptor.getSampleType()) != sizeof(T))
+            throw InvalidSampleTypeException("The domain view type does not match the domain sample type.");
+
+        const auto rule = descriptor.getRule();
+        const auto packetOffset = domainPacket.getOffset();
+        linear = rule.assigned() && rule.getType() == DataRuleType::Linear && packetOffset.assigned() &&
+                 !descriptor.getPostScaling().assigned();
+
+        if (linear)
+        {
+            // Matches the arithmetic of the packet's data rule calculation
+            const auto parameters = rule.getParameters();
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                delta = static_cast<T>(parameters.get("delta").template asPtr<INumber>().getFloatValue());
+                offset = static_cast<T>(packetOffset.getFloatValue()) +
+                         static_cast<T>(parameters.get("start").template asPtr<INumber>().getFloatValue());
+            }
+            else
+            {
+                delta = static_cast<T>(parameters.get("delta").template asPtr<INumber>().getIntValue());
+                offset = static_cast<T>(packetOffset.getIntValue()) +
+                         static_cast<T>(parameters.get("start").template asPtr<INumber>().getIntValue());
+            }
+        }
+        else if (sampleCount > 0)
+        {
+            values = static_cast<const T*>(domainPacket.getData());
+        }
+    }
+
+    /*!
+     * @brief Returns true if the values are computed from the linear rule of the packet.
+     */
+    bool isLinear() const
+    {
+        return linear;
+    }
+
+    SizeT getSampleCount() const
+    {
+        return sampleCount;
+    }
+
+    /*!
+     * @brief Gets the linear rule delta. Only valid if the view is linear.
+     */
+    T getDelta() const
+    {
+        return delta;
+    }
+
+    T operator[](SizeT index) const
+    {
+        if (linear)
+            return delta * static_cast<T>(index) + offset;
+
+        return values[index];
+    }
+
+    T getFirstValue() const
+    {
+        return (*this)[0];
+    }
+
+    T getLastValue() const
+    {
+        return (*this)[sampleCount - 1];
+    }
+
+    /*!
+     * @brief Writes `count` values, starting at `index`, to the output buffer converted to its type.
+     * @returns The pointer to the value after the last written one.
+     */
+    template <typename TOut>
+    TOut* copyTo(TOut* output, SizeT index, SizeT count) const
+    {
+        if (linear)
+        {
+            for (SizeT i = 0; i < count; ++i)
+                output[i] = static_cast<TOut>(delta * static_cast<T>(index + i) + offset);
+
+            return output + count;
+        }
+
+        return std::transform(values + index, values + index + count, output, [](T value) { return static_cast<TOut>(value); });
+    }
+
+private:
+    DataPacketPtr packet;
+    SizeT sampleCount;
+    bool linear{false};
+    const T* values{nullptr};
+    T delta{};
+    T offset{};
+};
+
+END_NAMESPACE_OPENDAQ
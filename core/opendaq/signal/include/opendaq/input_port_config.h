@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <opendaq/connection.h>
 #include <opendaq/context.h>
 #include <opendaq/input_port.h>
 #include <opendaq/task_graph.h>
@@ -32,7 +33,7 @@ enum class PacketReadyNotification
 {
     None,       ///< Ignore the notification.
     SameThread, ///< Call the listener in the same thread the notification was received.
-    Scheduler,  ///< Call the listener asynchronously or in another thread.
+    Scheduler,  ///< Call the listener asynchronously or in another thread. Notifications that arrive before the listener runs are coalesced into one call, and calls for the same port never overlap.
 };
 
  /*!
@@ -91,6 +92,20 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortConfig, IInputPort)
      * the owner of the input port (function block) should report an error.
      */
     virtual ErrCode INTERFACE_FUNC setRequiresSignal(Bool requiresSignal) = 0;
+
+    /*!
+     * @brief Sets the queue used by connections that are created when a signal is connected to the input port.
+     * @param capacity The maximum number of packets a connection can hold. If 0, the connection queue is unbounded.
+     * @param overflowPolicy Determines what happens when a packet is enqueued while the connection is full.
+     *
+     * The setting applies to connections established after the call; an existing connection keeps its queue.
+     * A bounded queue requires an overflow policy other than `Unbounded`.
+     *
+     * The `BlockProducer` policy cannot be used on ports with the `SameThread` notification method, as the packet
+     * listener would run on the blocked producer thread and could never make room in the queue. Such combinations
+     * are rejected by both this method and `setNotificationMethod` with `OPENDAQ_ERR_INVALIDSTATE`.
+     */
+    virtual ErrCode INTERFACE_FUNC setQueueOptions(SizeT capacity, QueueOverflowPolicy overflowPolicy) = 0;
 };
 /*!@}*/
 
@@ -27,9 +27,65 @@
 #include <opendaq/signal_errors.h>
 #include <opendaq/signal_events_ptr.h>
 #include <opendaq/signal_factory.h>
+#include <atomic>
+#include <memory>
 
 BEGIN_NAMESPACE_OPENDAQ
 
+// Coalesces the scheduler notifications of an input port. At most one dispatch is scheduled or running at any
+// time, so the listener of a port is never called concurrently or out of order. A notification that arrives while
+// the dispatch runs makes it call the listener once more before finishing, so nothing enqueued is left behind.
+class InputPortDispatchState
+{
+public:
+    // Returns true if no dispatch is pending and the caller has to schedule one.
+    bool request()
+    {
+        int state = current.load(std::memory_order_relaxed);
+        while (true)
+        {
+            const int next = state == Idle ? Scheduled : state == Running ? RunningRequested : state;
+            if (next == state)
+                return false;
+            if (current.compare_exchange_weak(state, next, std::memory_order_acq_rel))
+                return state == Idle;
+        }
+    }
+
+    void begin()
+    {
+        current.store(Running, std::memory_order_release);
+    }
+
+    // Returns true if a notification arrived while the listener was running; the dispatch then stays running and
+    // has to call the listener again.
+    bool finish()
+    {
+        int expected = Running;
+        if (current.compare_exchange_strong(expected, Idle, std::memory_order_acq_rel))
+            return false;
+
+        current.store(Running, std::memory_order_release);
+        return true;
+    }
+
+    void reset()
+    {
+        current.store(Idle, std::memory_order_release);
+    }
+
+private:
+    enum State : int
+    {
+        Idle,
+        Scheduled,
+        Running,
+        RunningRequested
+    };
+
+    std::atomic<int> current{Idle};
+};
+
 template <class... Interfaces>
 class GenericInputPortImpl;
 
@@ -61,11 +117,14 @@ public:
     ErrCode INTERFACE_FUNC getCustomData(IBaseObject** data) override;
     ErrCode INTERFACE_FUNC setCustomData(IBaseObject* data) override;
     ErrCode INTERFACE_FUNC setRequiresSignal(Bool requiresSignal) override;
+    ErrCode INTERFACE_FUNC setQueueOptions(SizeT capacity, QueueOverflowPolicy overflowPolicy) override;
 
     // IInputPortPrivate
     ErrCode INTERFACE_FUNC disconnectWithoutSignalNotification() override;
     ErrCode INTERFACE_FUNC getSerializedSignalId(IString** serializedSignalId) override;
     ErrCode INTERFACE_FUNC finishUpdate() override;
+    ErrCode INTERFACE_FUNC getNotificationMethod(PacketReadyNotification* method) override;
+    ErrCode INTERFACE_FUNC getListener(IInputPortNotifications** listener) override;
 
     // IRemovable
     ErrCode INTERFACE_FUNC remove() override;
@@ -92,6 +151,7 @@ protected:
                                        const FunctionPtr& factoryCallback) override;
 
     virtual ConnectionPtr createConnection(const SignalPtr& signal);
+    static bool isBlockingQueue(SizeT capacity, QueueOverflowPolicy overflowPolicy);
 
     ConnectionPtr getConnectionNoLock();
 
@@ -99,11 +159,14 @@ private:
     Bool requiresSignal;
     BaseObjectPtr customData;
     PacketReadyNotification notifyMethod{};
+    SizeT queueCapacity;
+    QueueOverflowPolicy queueOverflowPolicy;
 
     WeakRefPtr<IInputPortNotifications> listenerRef;
     WeakRefPtr<IConnection> connectionRef{};
     bool isInputPortRemoved;
     FunctionPtr notifySchedulerCallback;
+    std::shared_ptr<InputPortDispatchState> dispatchState;
 
     LoggerComponentPtr loggerComponent;
     SchedulerPtr scheduler;
@@ -129,9 +192,12 @@ GenericInputPortImpl<Interfaces ...>::GenericInputPortImpl(const ContextPtr& con
     : Super(context, parent, localId, className)
     , requiresSignal(true)
     , notifyMethod(PacketReadyNotification::None)
+    , queueCapacity(0)
+    , queueOverflowPolicy(QueueOverflowPolicy::Unbounded)
     , listenerRef(nullptr)
     , connectionRef(nullptr)
     , isInputPortRemoved(false)
+    , dispatchState(std::make_shared<InputPortDispatchState>())
 {
     loggerComponent = context.getLogger().getOrAddComponent("InputPort");
     if (context.assigned())
@@ -364,11 +430,13 @@ ErrCode GenericInputPortImpl<Interfaces...>::setNotificationMethod(PacketReadyNo
     if (method == PacketReadyNotification::Scheduler && !scheduler.assigned())
     {
         LOG_W("Scheduler based notification not available");
-        notifyMethod = PacketReadyNotification::SameThread;
+        method = PacketReadyNotification::SameThread;
     }
-    else
-        notifyMethod = method;
 
+    if (method == PacketReadyNotification::SameThread && isBlockingQueue(queueCapacity, queueOverflowPolicy))
+        return this->makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "Same thread notification cannot be used with the BlockProducer queue policy");
+
+    notifyMethod = method;
     return OPENDAQ_SUCCESS;
 }
 
@@ -395,7 +463,18 @@ void GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedSameThread()
 template <class... Interfaces>
 void GenericInputPortImpl<Interfaces...>::notifyPacketEnqueuedScheduler()
 {
-    scheduler.scheduleWork(notifySchedulerCallback);
+    if (!dispatchState->request())
+        return;
+
+    try
+    {
+        scheduler.scheduleWork(notifySchedulerCallback);
+    }
+    catch (...)
+    {
+        dispatchState->reset();
+        throw;
+    }
 }
 
 template <class... Interfaces>
@@ -450,12 +529,19 @@ ErrCode GenericInputPortImpl<Interfaces...>::setListener(IInputPortNotifications
     if (listenerRef.assigned())
     {
         auto portRef = this->template getWeakRefInternal<IInputPort>();
-        notifySchedulerCallback = [notifyRef = listenerRef, portRef = portRef, loggerComponent = loggerComponent]
+        notifySchedulerCallback = [notifyRef = listenerRef, portRef = portRef, dispatchState = dispatchState, loggerComponent = loggerComponent]
         {
-            auto notify = notifyRef.getRef();
-            auto port = portRef.getRef();
-            if (notify.assigned() && port.assigned())
+            dispatchState->begin();
+            do
             {
+                auto notify = notifyRef.getRef();
+                auto port = portRef.getRef();
+                if (!notify.assigned() || !port.assigned())
+                {
+                    dispatchState->reset();
+                    return false;
+                }
+
                 try
                 {
                     notify.packetReceived(port);
@@ -464,9 +550,14 @@ ErrCode GenericInputPortImpl<Interfaces...>::setListener(IInputPortNotifications
                 {
                     LOG_E("Input port notification failed: {}", e.what());
                 }
-                return true;
+                catch (...)
+                {
+                    LOG_E("Input port notification failed");
+                }
             }
-            return false;
+            while (dispatchState->finish());
+
+            return true;
         };
     }
     else
@@ -519,6 +610,26 @@ ErrCode INTERFACE_FUNC GenericInputPortImpl<Interfaces...>::getSerializedSignalI
     return OPENDAQ_SUCCESS;
 }
 
+template <class... Interfaces>
+ErrCode INTERFACE_FUNC GenericInputPortImpl<Interfaces...>::getNotificationMethod(PacketReadyNotification* method)
+{
+    OPENDAQ_PARAM_NOT_NULL(method);
+    std::scoped_lock lock(this->sync);
+
+    *method = notifyMethod;
+    return OPENDAQ_SUCCESS;
+}
+
+template <class... Interfaces>
+ErrCode INTERFACE_FUNC GenericInputPortImpl<Interfaces...>::getListener(IInputPortNotifications** listener)
+{
+    OPENDAQ_PARAM_NOT_NULL(listener);
+    std::scoped_lock lock(this->sync);
+
+    *listener = listenerRef.assigned() ? listenerRef.getRef().detach() : nullptr;
+    return OPENDAQ_SUCCESS;
+}
+
 template <class... Interfaces>
 ErrCode GenericInputPortImpl<Interfaces...>::finishUpdate()
 {
@@ -676,6 +787,17 @@ void GenericInputPortImpl<Interfaces...>::deserializeCustomObjectValues(const Se
 template <class ... Interfaces>
 ConnectionPtr GenericInputPortImpl<Interfaces...>::createConnection(const SignalPtr& signal)
 {
+    SizeT capacity;
+    QueueOverflowPolicy overflowPolicy;
+    {
+        std::scoped_lock lock(this->sync);
+        capacity = queueCapacity;
+        overflowPolicy = queueOverflowPolicy;
+    }
+
+    if (capacity > 0)
+        return BoundedConnection(this->template thisPtr<InputPortPtr>(), signal, this->context, capacity, overflowPolicy);
+
     const auto connection = Connection(this->template thisPtr<InputPortPtr>(), signal, this->context);
     return connection;
 }
@@ -709,6 +831,29 @@ ErrCode GenericInputPortImpl<Interfaces...>::setRequiresSignal(Bool requiresSign
     return OPENDAQ_SUCCESS;
 }
 
+template <class... Interfaces>
+bool GenericInputPortImpl<Interfaces...>::isBlockingQueue(SizeT capacity, QueueOverflowPolicy overflowPolicy)
+{
+    return capacity > 0 && overflowPolicy == QueueOverflowPolicy::BlockProducer;
+}
+
+template <class... Interfaces>
+ErrCode GenericInputPortImpl<Interfaces...>::setQueueOptions(SizeT capacity, QueueOverflowPolicy overflowPolicy)
+{
+    std::scoped_lock lock(this->sync);
+
+    if (capacity > 0 && overflowPolicy == QueueOverflowPolicy::Unbounded)
+        return this->makeErrorInfo(OPENDAQ_ERR_INVALIDPARAMETER, "A bounded queue requires an overflow policy");
+
+    // The consumer of a same thread notified port runs on the producer thread, so a blocked producer would never be released
+    if (notifyMethod == PacketReadyNotification::SameThread && isBlockingQueue(capacity, overflowPolicy))
+        return this->makeErrorInfo(OPENDAQ_ERR_INVALIDSTATE, "The BlockProducer queue policy cannot be used with same thread notification");
+
+    this->queueCapacity = capacity;
+    this->queueOverflowPolicy = overflowPolicy;
+    return OPENDAQ_SUCCESS;
+}
+
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(InputPortImpl)
 
 END_NAMESPACE_OPENDAQ
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <coretypes/baseobject.h>
+#include <opendaq/input_port_config.h>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -47,6 +48,18 @@ DECLARE_OPENDAQ_INTERFACE(IInputPortPrivate, IBaseObject)
      * @brief Called when update from serialized string is done.
      */
     virtual ErrCode INTERFACE_FUNC finishUpdate() = 0;
+
+    /*!
+     * @brief Gets the method used to handle the packet-enqueued notification.
+     * @param[out] method The notification method.
+     */
+    virtual ErrCode INTERFACE_FUNC getNotificationMethod(PacketReadyNotification* method) = 0;
+
+    /*!
+     * @brief Gets the listener notified when packets are enqueued.
+     * @param[out] listener The listener, or null if none is set or it was already released.
+     */
+    virtual ErrCode INTERFACE_FUNC getListener(IInputPortNotifications** listener) = 0;
 };
 /*!@}*/
 
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <coretypes/common.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @brief A fixed set of monotonically increasing counters, sharded by thread.
+ *
+ * Each thread increments the counters of its own cache-line-sized shard with relaxed atomics, so concurrent
+ * producers do not bounce a shared cache line between cores. Reading sums up all shards; the result is exact
+ * once the writers are quiescent and otherwise a close lower bound.
+ */
+template <std::size_t CounterCount, std::size_t ShardCount = 4>
+class ShardedCounters
+{
+public:
+    void add(std::size_t counter, UInt value) noexcept
+    {
+        shards[shardIndex()].counters[counter].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    UInt get(std::size_t counter) const noexcept
+    {
+        UInt sum = 0;
+        for (const auto& shard : shards)
+            sum += shard.counters[counter].load(std::memory_order_relaxed);
+        return sum;
+    }
+
+private:
+    static constexpr std::size_t CacheLineSize = 64;
+
+    struct alignas(CacheLineSize) Shard
+    {
+        std::array<std::atomic<UInt>, CounterCount> counters{};
+    };
+
+    static std::size_t shardIndex() noexcept
+    {
+        static std::atomic<std::size_t> nextThread{0};
+        thread_local const std::size_t index = nextThread.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+        return index;
+    }
+
+    std::array<Shard, ShardCount> shards{};
+};
+
+/*!
+ * @brief Histogram of time intervals with power-of-two microsecond buckets.
+ *
+ * Bucket 0 counts intervals shorter than 1 us, bucket `i` counts intervals in the range [2^(i-1), 2^i) us,
+ * and the last bucket counts all intervals of at least 2^(BucketCount-2) us (about 1 s).
+ */
+class LatencyHistogram
+{
+public:
+    static constexpr std::size_t BucketCount = 22;
+
+    void record(std::chrono::steady_clock::duration interval) noexcept
+    {
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(interval).count();
+
+        std::size_t bucket = 0;
+        for (auto remaining = us > 0 ? static_cast<UInt>(us) : 0; remaining != 0 && bucket < BucketCount - 1; remaining >>= 1)
+            ++bucket;
+
+        buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    UInt getBucket(std::size_t bucket) const noexcept
+    {
+        return buckets[bucket].load(std::memory_order_relaxed);
+    }
+
+    UInt getOverflowCount() const noexcept
+    {
+        return getBucket(BucketCount - 1);
+    }
+
+private:
+    std::array<std::atomic<UInt>, BucketCount> buckets{};
+};
+
+END_NAMESPACE_OPENDAQ
@@ -68,6 +68,28 @@ inline DataPacketPtr DataPacketWithDomain(const DataPacketPtr& domainPacket,
     return obj;
 }
 
+/*!
+ * @brief Creates a Data packet whose scaled or rule-calculated data is allocated with a given allocator.
+ * @param domainPacket The Data packet carrying domain data.
+ * @param descriptor The descriptor of the signal sending the data.
+ * @param sampleCount The number of samples in the packet.
+ * @param offset Optional packet offset parameter, used to calculate the data of the packet
+ * if the Data rule of the Signal descriptor is not explicit.
+ * @param allocator A memory allocator to use for the raw data buffer.
+ * @param scaledDataAllocator A memory allocator to use for the buffer returned by `getData`.
+ */
+inline DataPacketPtr DataPacketWithScaledDataAllocator(const DataPacketPtr& domainPacket,
+                                                       const DataDescriptorPtr& descriptor,
+                                                       uint64_t sampleCount,
+                                                       NumberPtr offset,
+                                                       AllocatorPtr allocator,
+                                                       AllocatorPtr scaledDataAllocator)
+{
+    DataPacketPtr obj(DataPacketWithScaledDataAllocator_Create(
+        domainPacket, descriptor, sampleCount, offset, std::move(allocator), std::move(scaledDataAllocator)));
+    return obj;
+}
+
 /*!
  * @brief Creates a Data packet with a given descriptor, sample count,
  * a reference to a packet that describes the domain (time) data,
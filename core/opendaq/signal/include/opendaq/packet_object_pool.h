@@ -0,0 +1,48 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator_statistics.h>
+#include <coretypes/common.h>
+#include <coretypes/intfs.h>
+#include <cstddef>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+// Recycles the memory of packet objects, which are created and destroyed at a high rate on the acquisition path.
+// Each thread keeps released objects in a small per-size cache that is accessed without locking. Full and empty
+// caches exchange objects with a bounded shared depot in batches, so the depot lock is taken only once per batch
+// even when packets are created on one thread and released on another.
+class PacketObjectPool
+{
+public:
+    static void* allocate(std::size_t size);
+    static void release(void* address, std::size_t size) noexcept;
+
+    static SizeT getHitCount();
+    static SizeT getMissCount();
+    static SizeT getPooledBytes();
+};
+
+class PacketObjectPoolStatisticsImpl : public ImplementationOf<IAllocatorStatistics>
+{
+public:
+    ErrCode INTERFACE_FUNC getHitCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getMissCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getPooledBytes(SizeT* bytes) override;
+};
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator_ptr.h>
+#include <opendaq/allocator_statistics_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_allocator
+ * @addtogroup opendaq_allocator_factories Factories
+ * @{
+ */
+
+/*!
+ * @brief Creates an allocator that keeps released buffers in per-size-class free lists and reuses them
+ * for subsequent allocations of the same size class.
+ * @param maxPooledBytes The maximum amount of released memory kept for reuse. Buffers released
+ *                       while the pool is full are returned to the system.
+ *
+ * Requested sizes are rounded up to the next power of two, so packets whose sample count varies
+ * slightly between calls still reuse each other's buffers. Acquisition loops that repeatedly create
+ * packets of a similar size reach a steady state without heap allocations. The allocator implements
+ * `IAllocatorStatistics`.
+ */
+inline AllocatorPtr PoolAllocator(SizeT maxPooledBytes = 4 * 1024 * 1024)
+{
+    AllocatorPtr obj(PoolAllocator_Create(maxPooledBytes));
+    return obj;
+}
+
+/*!
+ * @brief Gets the statistics of the process-wide pool that recycles the memory of data packet objects.
+ *
+ * The statistics cover the packet objects themselves, not their sample buffers, which are provided
+ * by the allocator of each packet.
+ */
+inline AllocatorStatisticsPtr PacketObjectPoolStatistics()
+{
+    AllocatorStatisticsPtr obj(PacketObjectPoolStatistics_Create());
+    return obj;
+}
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
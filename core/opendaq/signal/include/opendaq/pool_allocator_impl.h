@@ -0,0 +1,75 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <opendaq/allocator.h>
+#include <opendaq/allocator_statistics.h>
+#include <opendaq/data_descriptor.h>
+#include <coretypes/common.h>
+#include <coretypes/intfs.h>
+#include <array>
+#include <mutex>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+// Allocation sizes are rounded up to power-of-two size classes with one free list per class, so the number
+// of free lists is fixed regardless of how many distinct packet sizes are requested. Each block is prefixed
+// with a header holding its size class. Blocks are aligned to `std::max_align_t`; blocks requiring a stricter
+// alignment are allocated and freed directly, bypassing the pool.
+class PoolAllocatorImpl : public ImplementationOf<IAllocator, IAllocatorStatistics>
+{
+public:
+    explicit PoolAllocatorImpl(SizeT maxPooledBytes);
+    ~PoolAllocatorImpl() override;
+
+    ErrCode INTERFACE_FUNC allocate(
+        const IDataDescriptor *descriptor,
+        daq::SizeT bytes,
+        daq::SizeT align,
+        VoidPtr* address) override;
+
+    ErrCode INTERFACE_FUNC free(VoidPtr address) override;
+
+    ErrCode INTERFACE_FUNC getHitCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getMissCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getPooledBytes(SizeT* bytes) override;
+
+private:
+    struct alignas(std::max_align_t) BlockHeader
+    {
+        SizeT sizeClass;
+        void* base;  // start of the allocation, set only for over-aligned blocks
+    };
+
+    static constexpr SizeT MinSizeClass = 4;
+    static constexpr SizeT SizeClassCount = sizeof(SizeT) * 8;
+    static constexpr SizeT OverAlignedClass = SizeClassCount;
+
+    static SizeT getSizeClass(SizeT bytes);
+    static SizeT getClassSize(SizeT sizeClass);
+    static SizeT getAlignment(SizeT align);
+    static BlockHeader* allocateOverAligned(SizeT bytes, SizeT alignment);
+
+    std::mutex sync;
+    std::array<std::vector<BlockHeader*>, SizeClassCount> freeLists;
+    SizeT maxPooledBytes;
+    SizeT pooledBytes;
+    SizeT hitCount;
+    SizeT missCount;
+};
+
+END_NAMESPACE_OPENDAQ
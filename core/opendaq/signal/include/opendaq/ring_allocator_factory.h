@@ -0,0 +1,57 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/allocator_ptr.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_allocator
+ * @addtogroup opendaq_allocator_factories Factories
+ * @{
+ */
+
+/*!
+ * @brief Creates an allocator that hands out consecutive slices of one contiguous ring buffer.
+ * @param capacity The size of the ring buffer in bytes.
+ * @param timeoutMs The time an allocation waits for older slices to be released when the ring is full.
+ * @param useHugePages Requests the ring buffer to be backed by huge pages where the platform supports it.
+ * @param heapFallback If true, allocations the ring cannot serve in time, or that are larger than the ring,
+ *                     are allocated on the heap. Otherwise they return null, and the data packet constructor
+ *                     throws `NoMemoryException`.
+ *
+ * Intended for device drivers that produce packets of a signal at a steady rate. Slices are returned to
+ * the ring when their packets are destroyed, in allocation order, so a single packet held by a consumer
+ * keeps the ring from reclaiming the slices allocated after it. Without the heap fallback, the memory of a
+ * signal is bounded by the ring capacity and a producer whose consumers hold packets too long is slowed
+ * down (or fails) instead of growing the heap. Drivers that fill the packet buffer obtained with
+ * `getRawData` directly, for example as the target of a DMA transfer, publish their data without any
+ * copies or heap allocations.
+ *
+ * The allocator implements `IAllocatorStatistics`: allocations served from the ring are counted as hits,
+ * heap fallback allocations as misses, and the free space of the ring is reported as pooled bytes.
+ */
+inline AllocatorPtr RingAllocator(SizeT capacity, SizeT timeoutMs = 0, Bool useHugePages = false, Bool heapFallback = false)
+{
+    AllocatorPtr obj(RingAllocator_Create(capacity, timeoutMs, useHugePages, heapFallback));
+    return obj;
+}
+
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <opendaq/allocator.h>
+#include <opendaq/allocator_statistics.h>
+#include <opendaq/data_descriptor.h>
+#include <coretypes/common.h>
+#include <coretypes/intfs.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+// Slices are carved out of one contiguous buffer in allocation order. Each slice is prefixed with a header
+// holding its size and release state. Released slices are returned to the ring only once all older slices
+// are released, so free space is always one or two contiguous regions. A slice that does not fit at the end
+// of the buffer wraps to the start, and the skipped tail is accounted as a released padding slice. With the heap
+// fallback enabled, allocations the ring cannot serve are allocated on the heap; they are recognized on release
+// by their address lying outside of the ring buffer.
+class RingAllocatorImpl : public ImplementationOf<IAllocator, IAllocatorStatistics>
+{
+public:
+    explicit RingAllocatorImpl(SizeT capacity, SizeT timeoutMs, Bool useHugePages, Bool heapFallback);
+    ~RingAllocatorImpl() override;
+
+    ErrCode INTERFACE_FUNC allocate(
+        const IDataDescriptor *descriptor,
+        daq::SizeT bytes,
+        daq::SizeT align,
+        VoidPtr* address) override;
+
+    ErrCode INTERFACE_FUNC free(VoidPtr address) override;
+
+    ErrCode INTERFACE_FUNC getHitCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getMissCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getPooledBytes(SizeT* bytes) override;
+
+private:
+    static constexpr SizeT SliceAlignment = 64;
+
+    struct alignas(SliceAlignment) SliceHeader
+    {
+        SizeT size;
+        bool released;
+    };
+
+    static SizeT roundUp(SizeT bytes);
+    static SizeT getAlignment(SizeT align);
+    static void* allocateFromHeap(SizeT bytes, SizeT alignment);
+    static void freeFromHeap(void* address);
+
+    SliceHeader* reserve(SizeT size);
+    SliceHeader* headerAt(SizeT position) const;
+    bool isInRing(const void* address) const;
+    void allocateBuffer(bool useHugePages);
+    void freeBuffer();
+
+    std::mutex sync;
+    std::condition_variable spaceReleased;
+    uint8_t* buffer;
+    SizeT capacity;
+    std::chrono::milliseconds timeout;
+    bool heapFallback;
+    bool mapped;
+
+    SizeT head;
+    SizeT tail;
+    SizeT used;
+    SizeT hitCount;
+    SizeT missCount;
+};
+
+END_NAMESPACE_OPENDAQ
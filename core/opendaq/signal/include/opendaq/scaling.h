@@ -35,7 +35,9 @@ struct IScalingBuilder;
 enum class ScalingType
 {
     Other = 0, 
-    Linear ///< The parameters contain a `scale` and `offset`. Calculated as: <em>inputValue * scale + offset</em> .
+    Linear, ///< The parameters contain a `scale` and `offset`. Calculated as: <em>inputValue * scale + offset</em> .
+    Polynomial, ///< The parameters contain a list of `coefficients`. Calculated as: <em>sum(coefficients[i] * inputValue^i)</em> .
+    LookupTable ///< The parameters contain `input` and `output` lists. The output is linearly interpolated between table entries.
 };
 
 /*#
@@ -63,6 +65,21 @@ enum class ScalingType
  *   - Offset: a constant that is added to the <em>scale * value</em> multiplication result
  *
  * The linear scaling output is calculated as follows: <em>inputValue * scale + offset</em>
+ *
+ * @subsubsection scaling_types_polynomial Polynomial scaling
+ * Polynomial scaling parameters must have one entry:
+ *   - Coefficients: a list of 1 to 6 numbers, ordered from the constant term upwards
+ *
+ * The polynomial scaling output is calculated as follows:
+ * <em>coefficients[0] + coefficients[1] * inputValue + ... + coefficients[n] * inputValue^n</em>
+ *
+ * @subsubsection scaling_types_lookup_table Lookup table scaling
+ * Lookup table scaling parameters must have two entries:
+ *   - Input: a list of at least two strictly increasing input values
+ *   - Output: a list of output values, one for each input value
+ *
+ * Input values between two table entries are linearly interpolated. Input values outside of the
+ * table are clamped to its first or last output value.
  */
 DECLARE_OPENDAQ_INTERFACE(IScaling, IBaseObject)
 {
@@ -18,6 +18,11 @@
 #include <opendaq/scaling_ptr.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/sample_type_traits.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -39,6 +44,14 @@ public:
 [[maybe_unused]]
 static ScalingCalc* createScalingCalcTyped(const ScalingPtr& scaling);
 
+template <typename U>
+static ScalingCalc* createScalingCalcWithOutputType(const ScalingPtr& scaling);
+
+/*
+ * Scales raw values of type T into values of type U. The kernel is chosen once, when the descriptor is built,
+ * so scaling a packet is a single indirect call followed by a branch-free loop over the samples that the
+ * compiler vectorizes.
+ */
 template <typename T, typename U>
 class ScalingCalcTyped : public ScalingCalc
 {
@@ -46,127 +59,272 @@ public:
     void* scaleData(void* data, SizeT sampleCount) override;
     void scaleData(void* data, SizeT sampleCount, void** output) override;
 
+    static constexpr SizeT MaxPolynomialOrder = 5;
+
 private:
-    friend ScalingCalc* createScalingCalcTyped(const ScalingPtr& scaling);
+    template <typename V>
+    friend ScalingCalc* createScalingCalcWithOutputType(const ScalingPtr& scaling);
     ScalingCalcTyped(const ScalingPtr& scaling);
 
-    void* scaleLinear(void* data, SizeT sampleCount);
-    void scaleLinear(void* data, SizeT sampleCount, void** output);
+    using Kernel = void (ScalingCalcTyped::*)(const T* rawData, U* scaledData, SizeT sampleCount) const;
+
+    static std::vector<U> readNumbers(const ListPtr<INumber>& list);
 
-    ScalingType type;
+    void initPolynomial(const ListPtr<INumber>& coefficients);
+    void initLookupTable(const ListPtr<INumber>& input, const ListPtr<INumber>& output);
+
+    void scaleLinear(const T* rawData, U* scaledData, SizeT sampleCount) const;
+    template <SizeT Order>
+    void scalePolynomial(const T* rawData, U* scaledData, SizeT sampleCount) const;
+    void scaleUniformTable(const T* rawData, U* scaledData, SizeT sampleCount) const;
+    void scaleTable(const T* rawData, U* scaledData, SizeT sampleCount) const;
+
+    Kernel kernel;
+
+    // Linear scale and offset, or the polynomial coefficients in ascending order
     std::vector<U> params;
+
+    // Lookup table breakpoints, with the slope of each segment
+    std::vector<U> tableInput;
+    std::vector<U> tableOutput;
+    std::vector<U> tableSlope;
+    U tableStart{};
+    U tableInverseStep{};
 };
 
 template <typename T, typename U>
 ScalingCalcTyped<T, U>::ScalingCalcTyped(const ScalingPtr& scaling)
+    : kernel(nullptr)
 {
-    type = scaling.getType();
-    if (type == ScalingType::Linear)
+    const auto parameters = scaling.getParameters();
+    switch (scaling.getType())
     {
-        U scale = scaling.getParameters().get("scale");
-        U offset = scaling.getParameters().get("offset");
-        params.push_back(scale);
-        params.push_back(offset);
+        case ScalingType::Linear:
+        {
+            U scale = parameters.get("scale");
+            U offset = parameters.get("offset");
+            params.push_back(scale);
+            params.push_back(offset);
+            kernel = &ScalingCalcTyped::scaleLinear;
+            break;
+        }
+        case ScalingType::Polynomial:
+            initPolynomial(parameters.get("coefficients"));
+            break;
+        case ScalingType::LookupTable:
+            initLookupTable(parameters.get("input"), parameters.get("output"));
+            break;
+        case ScalingType::Other:
+            break;
     }
 }
 
 template <typename T, typename U>
-void* ScalingCalcTyped<T, U>::scaleData(void* data, SizeT sampleCount)
+std::vector<U> ScalingCalcTyped<T, U>::readNumbers(const ListPtr<INumber>& list)
 {
-    if (type == ScalingType::Linear)
-        return scaleLinear(data, sampleCount);
+    std::vector<U> values;
+    values.reserve(list.getCount());
+    for (const auto& value : list)
+        values.push_back(static_cast<U>(value.getFloatValue()));
 
-    throw(UnknownRuleTypeException{});
+    return values;
 }
 
 template <typename T, typename U>
-void ScalingCalcTyped<T, U>::scaleData(void* data, SizeT sampleCount, void** output)
+void ScalingCalcTyped<T, U>::initPolynomial(const ListPtr<INumber>& coefficients)
 {
-    if (type == ScalingType::Linear)
+    params = readNumbers(coefficients);
+    switch (params.size())
     {
-        scaleLinear(data, sampleCount, output);
-        return;
+        case 1:
+            kernel = &ScalingCalcTyped::template scalePolynomial<0>;
+            break;
+        case 2:
+            kernel = &ScalingCalcTyped::template scalePolynomial<1>;
+            break;
+        case 3:
+            kernel = &ScalingCalcTyped::template scalePolynomial<2>;
+            break;
+        case 4:
+            kernel = &ScalingCalcTyped::template scalePolynomial<3>;
+            break;
+        case 5:
+            kernel = &ScalingCalcTyped::template scalePolynomial<4>;
+            break;
+        case 6:
+            kernel = &ScalingCalcTyped::template scalePolynomial<5>;
+            break;
+        default:
+            throw InvalidParameterException("Polynomial scaling supports up to 6 coefficients.");
     }
+}
+
+template <typename T, typename U>
+void ScalingCalcTyped<T, U>::initLookupTable(const ListPtr<INumber>& input, const ListPtr<INumber>& output)
+{
+    tableInput = readNumbers(input);
+    tableOutput = readNumbers(output);
+
+    const SizeT count = tableInput.size();
+    tableSlope.resize(count - 1);
+    for (SizeT i = 0; i + 1 < count; ++i)
+        tableSlope[i] = (tableOutput[i + 1] - tableOutput[i]) / (tableInput[i + 1] - tableInput[i]);
+
+    // Calibration tables are usually sampled at equal input steps, in which case the segment is found
+    // arithmetically instead of by a search
+    const double start = tableInput.front();
+    const double step = (static_cast<double>(tableInput.back()) - start) / static_cast<double>(count - 1);
+    const double tolerance = std::abs(step) * 1e-6;
 
-    throw(UnknownRuleTypeException{});
+    bool uniform = true;
+    for (SizeT i = 1; i < count && uniform; ++i)
+        uniform = std::abs(static_cast<double>(tableInput[i]) - (start + step * static_cast<double>(i))) <= tolerance;
+
+    if (uniform)
+    {
+        tableStart = static_cast<U>(start);
+        tableInverseStep = static_cast<U>(1.0 / step);
+        kernel = &ScalingCalcTyped::scaleUniformTable;
+    }
+    else
+    {
+        kernel = &ScalingCalcTyped::scaleTable;
+    }
 }
 
 template <typename T, typename U>
-void* ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount)
+void* ScalingCalcTyped<T, U>::scaleData(void* data, SizeT sampleCount)
 {
+    if (kernel == nullptr)
+        throw(UnknownRuleTypeException{});
+
     auto scaledData = std::malloc(sampleCount * sizeof(U));
     if (!scaledData)
         throw NoMemoryException("Memory allocation failed.");
 
-    this->scaleLinear(data, sampleCount, &scaledData);
+    (this->*kernel)(static_cast<const T*>(data), static_cast<U*>(scaledData), sampleCount);
     return scaledData;
 }
 
 template <typename T, typename U>
-void ScalingCalcTyped<T, U>::scaleLinear(void* data, SizeT sampleCount, void** output)
+void ScalingCalcTyped<T, U>::scaleData(void* data, SizeT sampleCount, void** output)
+{
+    if (kernel == nullptr)
+        throw(UnknownRuleTypeException{});
+
+    (this->*kernel)(static_cast<const T*>(data), static_cast<U*>(*output), sampleCount);
+}
+
+template <typename T, typename U>
+void ScalingCalcTyped<T, U>::scaleLinear(const T* rawData, U* scaledData, SizeT sampleCount) const
 {
-    T* rawData = static_cast<T*>(data);
-    U* scaledData = static_cast<U*>(*output);
     const U scale = params[0];
     const U offset = params[1];
     for (SizeT i = 0; i < sampleCount; ++i)
         scaledData[i] = scale * static_cast<U>(rawData[i]) + offset;
 }
 
+template <typename T, typename U>
+template <SizeT Order>
+void ScalingCalcTyped<T, U>::scalePolynomial(const T* rawData, U* scaledData, SizeT sampleCount) const
+{
+    std::array<U, Order + 1> coefficients;
+    std::copy_n(params.begin(), Order + 1, coefficients.begin());
+
+    // Horner's method; the inner loop has a constant trip count and is unrolled
+    for (SizeT i = 0; i < sampleCount; ++i)
+    {
+        const U value = static_cast<U>(rawData[i]);
+        U result = coefficients[Order];
+        for (SizeT k = Order; k > 0; --k)
+            result = result * value + coefficients[k - 1];
+        scaledData[i] = result;
+    }
+}
+
+template <typename T, typename U>
+void ScalingCalcTyped<T, U>::scaleUniformTable(const T* rawData, U* scaledData, SizeT sampleCount) const
+{
+    const U* output = tableOutput.data();
+    const U* slope = tableSlope.data();
+    const U* input = tableInput.data();
+    const U lastPosition = static_cast<U>(tableSlope.size());
+    const SizeT lastSegment = tableSlope.size() - 1;
+
+    for (SizeT i = 0; i < sampleCount; ++i)
+    {
+        const U value = static_cast<U>(rawData[i]);
+
+        // Clamped to the table; written so that NaN ends up at the first entry
+        U position = (value - tableStart) * tableInverseStep;
+        position = position > U(0) ? position : U(0);
+        position = position < lastPosition ? position : lastPosition;
+
+        const SizeT segment = std::min(static_cast<SizeT>(position), lastSegment);
+        const U clamped = std::min(std::max(value, input[0]), input[lastSegment + 1]);
+        scaledData[i] = output[segment] + slope[segment] * (clamped - input[segment]);
+    }
+}
+
+template <typename T, typename U>
+void ScalingCalcTyped<T, U>::scaleTable(const T* rawData, U* scaledData, SizeT sampleCount) const
+{
+    const auto inputBegin = tableInput.begin() + 1;
+    const auto inputEnd = tableInput.end() - 1;
+
+    for (SizeT i = 0; i < sampleCount; ++i)
+    {
+        const U value = static_cast<U>(rawData[i]);
+        const U clamped = std::min(std::max(value, tableInput.front()), tableInput.back());
+
+        const SizeT segment = static_cast<SizeT>(std::upper_bound(inputBegin, inputEnd, clamped) - inputBegin);
+        scaledData[i] = tableOutput[segment] + tableSlope[segment] * (clamped - tableInput[segment]);
+    }
+}
+
+template <typename U>
+ScalingCalc* createScalingCalcWithOutputType(const ScalingPtr& scaling)
+{
+    switch (scaling.getInputSampleType())
+    {
+        case SampleType::Float32:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::Float32>::Type, U>(scaling);
+        case SampleType::Float64:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::Float64>::Type, U>(scaling);
+        case SampleType::UInt8:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt8>::Type, U>(scaling);
+        case SampleType::Int8:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::Int8>::Type, U>(scaling);
+        case SampleType::UInt16:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt16>::Type, U>(scaling);
+        case SampleType::Int16:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::Int16>::Type, U>(scaling);
+        case SampleType::UInt32:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt32>::Type, U>(scaling);
+        case SampleType::Int32:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::Int32>::Type, U>(scaling);
+        case SampleType::UInt64:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt64>::Type, U>(scaling);
+        case SampleType::Int64:
+            return new ScalingCalcTyped<SampleTypeToType<SampleType::Int64>::Type, U>(scaling);
+        default:
+            break;
+    }
+
+    throw InvalidSampleTypeException{"The scaling input or output type is not supported."};
+}
+
 static ScalingCalc* createScalingCalcTyped(const ScalingPtr& scaling)
 {
-    const auto inputType = scaling.getInputSampleType();
-    const auto outputType = scaling.getOutputSampleType();
-
-    if (inputType == SampleType::Float32 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Float32>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-    if (inputType == SampleType::Float64 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Float64>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-
-    if (inputType == SampleType::UInt8 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt8>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-    if (inputType == SampleType::Int8 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int8>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-
-    if (inputType == SampleType::UInt16 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt16>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-    if (inputType == SampleType::Int16 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int16>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-
-    if (inputType == SampleType::UInt32 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt32>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-    if (inputType == SampleType::Int32 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int32>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-
-    if (inputType == SampleType::UInt64 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt64>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-    if (inputType == SampleType::Int64 && outputType == ScaledSampleType::Float32)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int64>::Type, SampleTypeToType<SampleType::Float32>::Type>(scaling);
-
-    if (inputType == SampleType::Float32 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Float32>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-    if (inputType == SampleType::Float64 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Float64>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-
-    if (inputType == SampleType::UInt8 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt8>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-    if (inputType == SampleType::Int8 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int8>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-
-    if (inputType == SampleType::UInt16 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt16>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-    if (inputType == SampleType::Int16 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int16>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-
-    if (inputType == SampleType::UInt32 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt32>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-    if (inputType == SampleType::Int32 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int32>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-
-    if (inputType == SampleType::UInt64 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::UInt64>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
-    if (inputType == SampleType::Int64 && outputType == ScaledSampleType::Float64)
-        return new ScalingCalcTyped<SampleTypeToType<SampleType::Int64>::Type, SampleTypeToType<SampleType::Float64>::Type>(scaling);
+    switch (scaling.getOutputSampleType())
+    {
+        case ScaledSampleType::Float32:
+            return createScalingCalcWithOutputType<SampleTypeToType<SampleType::Float32>::Type>(scaling);
+        case ScaledSampleType::Float64:
+            return createScalingCalcWithOutputType<SampleTypeToType<SampleType::Float64>::Type>(scaling);
+        case ScaledSampleType::Invalid:
+            break;
+    }
 
     throw InvalidSampleTypeException{"The scaling input or output type is not supported."};
 }
@@ -59,6 +59,36 @@ inline ScalingPtr Scaling(SampleType inputDataType, ScaledSampleType outputDataT
     return obj;
 }
 
+/*!
+ * @brief Creates a Scaling with a Polynomial scaling type configuration.
+ *
+ * @param coefficients Between 1 and 6 polynomial coefficients, ordered from the constant term upwards.
+ * @param inputDataType The scaling's input data type.
+ * @param outputDataType The scaling's output data type.
+ */
+inline ScalingPtr PolynomialScaling(const ListPtr<INumber>& coefficients,
+                                    SampleType inputDataType = SampleType::Float64,
+                                    ScaledSampleType outputDataType = ScaledSampleType::Float64)
+{
+    return Scaling(inputDataType, outputDataType, ScalingType::Polynomial, Dict<IString, IBaseObject>({{"coefficients", coefficients}}));
+}
+
+/*!
+ * @brief Creates a Scaling with a LookupTable scaling type configuration.
+ *
+ * @param input Strictly increasing input values of the table.
+ * @param output Output values of the table, one for each input value.
+ * @param inputDataType The scaling's input data type.
+ * @param outputDataType The scaling's output data type.
+ */
+inline ScalingPtr LookupTableScaling(const ListPtr<INumber>& input,
+                                     const ListPtr<INumber>& output,
+                                     SampleType inputDataType = SampleType::Float64,
+                                     ScaledSampleType outputDataType = ScaledSampleType::Float64)
+{
+    return Scaling(inputDataType, outputDataType, ScalingType::LookupTable, Dict<IString, IBaseObject>({{"input", input}, {"output", output}}));
+}
+
 /*!
  * @brief Creates a Scaling object from Builder
  *
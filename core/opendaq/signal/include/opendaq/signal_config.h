@@ -96,6 +96,16 @@ DECLARE_OPENDAQ_INTERFACE(ISignalConfig, ISignal)
      * @param packet The packet to be sent.
      */
     virtual ErrCode INTERFACE_FUNC sendPacket(IPacket* packet) = 0;
+
+    // [elementType(packets, IPacket)]
+    /*!
+     * @brief Sends multiple packets through all connections of the signal.
+     * @param packets The packets to be sent, in order.
+     *
+     * Each connection enqueues the packets under a single lock acquisition and notifies its listener once
+     * for the whole batch, which is cheaper than calling `sendPacket` for each packet.
+     */
+    virtual ErrCode INTERFACE_FUNC sendPackets(IList* packets) = 0;
 };
 /*!@}*/
 
@@ -23,6 +23,9 @@
 #include <opendaq/connection_ptr.h>
 #include <opendaq/signal_config_ptr.h>
 #include <opendaq/signal_private_ptr.h>
+#include <opendaq/signal_statistics.h>
+#include <opendaq/metric_counters.h>
+#include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
 #include <coretypes/string_ptr.h>
 #include <opendaq/utility_sync.h>
@@ -31,6 +34,10 @@
 #include <coretypes/validation.h>
 #include <opendaq/component_impl.h>
 #include <opendaq/input_port_private_ptr.h>
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <thread>
 #include <utility>
 
 BEGIN_NAMESPACE_OPENDAQ
@@ -50,10 +57,10 @@ class SignalBase;
 using SignalImpl = SignalBase<ISignalConfig>;
 
 template <typename TInterface, typename... Interfaces>
-class SignalBase : public ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, Interfaces...>
+class SignalBase : public ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, ISignalStatistics, Interfaces...>
 {
 public:
-    using Super = ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, Interfaces...>;
+    using Super = ComponentImpl<TInterface, ISignalEvents, ISignalPrivate, ISignalStatistics, Interfaces...>;
     using Self = SignalBase<TInterface, Interfaces...>;
 
     SignalBase(const ContextPtr& context,
@@ -83,6 +90,7 @@ public:
     ErrCode INTERFACE_FUNC removeRelatedSignal(ISignal* signal) override;
     ErrCode INTERFACE_FUNC clearRelatedSignals() override;
     ErrCode INTERFACE_FUNC sendPacket(IPacket* packet) override;
+    ErrCode INTERFACE_FUNC sendPackets(IList* packets) override;
 
     // ISignalEvents
     ErrCode INTERFACE_FUNC listenerConnected(IConnection* connection) override;
@@ -94,6 +102,11 @@ public:
     ErrCode INTERFACE_FUNC clearDomainSignalWithoutNotification() override;
     ErrCode INTERFACE_FUNC enableKeepLastValue(Bool enabled) override;
 
+    // ISignalStatistics
+    ErrCode INTERFACE_FUNC getSentPacketCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getSentSampleCount(SizeT* count) override;
+    ErrCode INTERFACE_FUNC getSentByteCount(SizeT* bytes) override;
+
     // ISerializable
     ErrCode INTERFACE_FUNC getSerializeId(ConstCharPtr* id) const override;
 
@@ -103,6 +116,7 @@ protected:
     void serializeCustomObjectValues(const SerializerPtr& serializer, bool forUpdate) override;
     void updateObject(const SerializedObjectPtr& obj) override;
     int getSerializeFlags() override;
+    void activeChanged() override;
 
     virtual EventPacketPtr createDataDescriptorChangedEventPacket();
     virtual void onListenedStatusChanged(bool listened);
@@ -125,6 +139,8 @@ protected:
     DataDescriptorPtr dataDescriptor;
 
 private:
+    using ConnectionSnapshot = std::vector<ConnectionPtr>;
+
     StringPtr name;
     bool isPublic{};
     std::vector<SignalPtr> relatedSignals;
@@ -133,10 +149,46 @@ private:
     std::vector<ConnectionPtr> remoteConnections;
     std::vector<WeakRefPtr<ISignalConfig>> domainSignalReferences;
     StringPtr deserializedDomainSignalId;
-    bool keepLastPacket = true;
+
+    // Packets are sent without taking `sync`. The sending path reads an immutable copy of `connections`,
+    // which is replaced as a whole (under `sync`) whenever a listener connects or disconnects, and a copy
+    // of the component's active flag.
+    //
+    // Data packets are enqueued while holding `sendLock` shared, so data sent from different threads is not
+    // serialized. Event packets, such as the descriptor change sent by `setDescriptor`, are enqueued while
+    // holding it exclusively: every connection receives an event at the same position relative to the data
+    // sent by all threads. A listener that disconnects takes the lock exclusively once the new snapshot is
+    // published, so no sender still holding the previous snapshot enqueues into it afterwards.
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const ConnectionSnapshot>> connectionSnapshot;
+#else
+    // Dedicated to the snapshot pointer; held only while copying or swapping it
+    mutable SpinLock connectionSnapshotLock;
+    std::shared_ptr<const ConnectionSnapshot> connectionSnapshot;
+#endif
+    std::atomic<bool> sendActive;
+    mutable std::shared_mutex sendLock;
+
+    // Guards only the pointer swap of the last data packet, never held while calling into other objects
+    SpinLock lastPacketLock;
+    std::atomic<bool> keepLastPacket = true;
     DataPacketPtr lastDataPacket;
 
+    enum SentCounter : std::size_t
+    {
+        SentPackets,
+        SentSamples,
+        SentBytes,
+        SentCounterCount
+    };
+
+    mutable ShardedCounters<SentCounterCount> sentCounters;
+
+    void countSentPacket(const PacketPtr& packet) const;
     bool sendPacketInternal(const PacketPtr& packet, bool ignoreActive = false) const;
+    std::shared_ptr<const ConnectionSnapshot> loadConnections() const;
+    void publishConnections();
+    void setLastDataPacket(const DataPacketPtr& dataPacket);
     void triggerRelatedSignalsChanged();
     void disconnectInputPort(const ConnectionPtr& connection);
     void clearConnections(std::vector<ConnectionPtr>& connections);
@@ -156,6 +208,8 @@ SignalBase<TInterface, Interfaces...>::SignalBase(const ContextPtr& context,
     : Super(context, parent, localId, className)
     , dataDescriptor(std::move(descriptor))
     , isPublic(true)
+    , connectionSnapshot(std::make_shared<const ConnectionSnapshot>())
+    , sendActive(this->active)
 {
 }
 
@@ -498,31 +552,159 @@ ErrCode SignalBase<TInterface, Interfaces...>::sendPacket(IPacket* packet)
 
     const auto packetPtr = PacketPtr::Borrow(packet);
 
-    std::scoped_lock lock(this->sync);
-
     if (sendPacketInternal(packetPtr))
     {
-        const auto dataPacket = packetPtr.asPtrOrNull<IDataPacket>();
-        if (keepLastPacket && dataPacket.assigned() && dataPacket.getSampleCount())
-            lastDataPacket = dataPacket;
+        if (keepLastPacket.load(std::memory_order_relaxed))
+        {
+            const auto dataPacket = packetPtr.asPtrOrNull<IDataPacket>();
+            if (dataPacket.assigned() && dataPacket.getSampleCount())
+                setLastDataPacket(dataPacket);
+        }
         return OPENDAQ_SUCCESS;
     }
 
     return  OPENDAQ_IGNORED;
 }
 
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::sendPackets(IList* packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    const auto packetsPtr = ListPtr<IPacket>::Borrow(packets);
+
+    if (!sendActive.load(std::memory_order_acquire))
+        return OPENDAQ_IGNORED;
+
+    return daqTry([&packetsPtr, this]()
+    {
+        const auto enqueue = [this, &packetsPtr]
+        {
+            const auto snapshot = loadConnections();
+            for (auto& connection : *snapshot)
+                connection.enqueueMultiple(packetsPtr);
+        };
+
+        bool hasEvents = false;
+        for (const auto& packet : packetsPtr)
+            hasEvents = hasEvents || packet.getType() == PacketType::Event;
+
+        if (hasEvents)
+        {
+            std::unique_lock lock(sendLock);
+            enqueue();
+        }
+        else
+        {
+            std::shared_lock lock(sendLock);
+            enqueue();
+        }
+
+        for (const auto& packet : packetsPtr)
+            countSentPacket(packet);
+
+        if (keepLastPacket.load(std::memory_order_relaxed))
+        {
+            for (SizeT i = packetsPtr.getCount(); i > 0; --i)
+            {
+                const auto dataPacket = packetsPtr.getItemAt(i - 1).asPtrOrNull<IDataPacket>();
+                if (dataPacket.assigned() && dataPacket.getSampleCount())
+                {
+                    setLastDataPacket(dataPacket);
+                    break;
+                }
+            }
+        }
+    });
+}
+
 template <typename TInterface, typename... Interfaces>
 bool SignalBase<TInterface, Interfaces...>::sendPacketInternal(const PacketPtr& packet, bool ignoreActive) const
 {
-    if (!ignoreActive && !this->active)
+    if (!ignoreActive && !sendActive.load(std::memory_order_acquire))
         return false;
 
-    for (auto& connection : connections)
-        connection.enqueue(packet);
+    const auto enqueue = [this, &packet]
+    {
+        const auto snapshot = loadConnections();
+        for (auto& connection : *snapshot)
+            connection.enqueue(packet);
+    };
 
+    if (packet.getType() == PacketType::Event)
+    {
+        std::unique_lock lock(sendLock);
+        enqueue();
+    }
+    else
+    {
+        std::shared_lock lock(sendLock);
+        enqueue();
+    }
+
+    countSentPacket(packet);
     return true;
 }
 
+template <typename TInterface, typename... Interfaces>
+void SignalBase<TInterface, Interfaces...>::countSentPacket(const PacketPtr& packet) const
+{
+    sentCounters.add(SentPackets, 1);
+
+    if (packet.getType() != PacketType::Data)
+        return;
+
+    const auto dataPacket = packet.asPtrOrNull<IDataPacket>(true);
+    if (!dataPacket.assigned())
+        return;
+
+    sentCounters.add(SentSamples, dataPacket.getSampleCount());
+    sentCounters.add(SentBytes, dataPacket.getRawDataSize());
+}
+
+template <typename TInterface, typename... Interfaces>
+std::shared_ptr<const typename SignalBase<TInterface, Interfaces...>::ConnectionSnapshot>
+SignalBase<TInterface, Interfaces...>::loadConnections() const
+{
+#if defined(__cpp_lib_atomic_shared_ptr)
+    return connectionSnapshot.load(std::memory_order_acquire);
+#else
+    std::scoped_lock lock(connectionSnapshotLock);
+    return connectionSnapshot;
+#endif
+}
+
+template <typename TInterface, typename... Interfaces>
+void SignalBase<TInterface, Interfaces...>::publishConnections()
+{
+    auto snapshot = std::make_shared<const ConnectionSnapshot>(connections);
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    connectionSnapshot.store(std::move(snapshot), std::memory_order_release);
+#else
+    {
+        std::scoped_lock lock(connectionSnapshotLock);
+        std::swap(connectionSnapshot, snapshot);
+    }
+
+    // The previous snapshot is released outside of the lock, as this may release the last connection references
+#endif
+}
+
+template <typename TInterface, typename... Interfaces>
+void SignalBase<TInterface, Interfaces...>::setLastDataPacket(const DataPacketPtr& dataPacket)
+{
+    DataPacketPtr previous = dataPacket;
+    {
+        std::scoped_lock lock(lastPacketLock);
+        if (!keepLastPacket.load(std::memory_order_relaxed))
+            return;
+        std::swap(lastDataPacket, previous);
+    }
+
+    // The previous packet is released outside of the lock, as this may destroy it
+}
+
 template <typename TInterface, typename ... Interfaces>
 void SignalBase<TInterface, Interfaces...>::triggerRelatedSignalsChanged()
 {
@@ -578,9 +760,12 @@ ErrCode SignalBase<TInterface, Interfaces...>::listenerConnected(IConnection* co
 
     connections.push_back(connectionPtr);
 
+    // Enqueued before the connection is published, so that no data packet can precede the descriptor
     const auto packet = createDataDescriptorChangedEventPacket();
     connectionPtr.enqueueOnThisThread(packet);
 
+    publishConnections();
+
     return OPENDAQ_SUCCESS;
 }
 
@@ -608,6 +793,12 @@ ErrCode SignalBase<TInterface, Interfaces...>::listenerDisconnected(IConnection*
         return OPENDAQ_ERR_NOTFOUND;
 
     connections.erase(it);
+    publishConnections();
+
+    // Waits for senders that may still hold the previous snapshot
+    {
+        std::unique_lock fence(sendLock);
+    }
 
     if (connections.empty())
     {
@@ -737,6 +928,14 @@ void SignalBase<TInterface, Interfaces...>::updateObject(const SerializedObjectP
         isPublic = obj.readBool("public");
 
     Super::updateObject(obj);
+    sendActive = this->active;
+}
+
+template <typename TInterface, typename... Interfaces>
+void SignalBase<TInterface, Interfaces...>::activeChanged()
+{
+    sendActive = this->active;
+    Super::activeChanged();
 }
 
 
@@ -771,6 +970,7 @@ void SignalBase<TInterface, Interfaces...>::removed()
 {
     clearConnections(connections);
     clearConnections(remoteConnections);
+    publishConnections();
 
     for (auto it = begin(domainSignalReferences); it != end(domainSignalReferences); ++it)
     {
@@ -803,6 +1003,7 @@ void SignalBase<TInterface, Interfaces...>::deserializeCustomObjectValues(const
                                                                     const FunctionPtr& factoryCallback)
 {
     Super::deserializeCustomObjectValues(serializedObject, context, factoryCallback);
+    sendActive = this->active;
     if (serializedObject.hasKey("domainSignalId"))
         deserializedDomainSignalId = serializedObject.readString("domainSignalId");
     if (serializedObject.hasKey("dataDescriptor"))
@@ -838,11 +1039,41 @@ ErrCode SignalBase<TInterface, Interfaces...>::lockAllAttributesInternal()
 template <typename TInterface, typename... Interfaces>
 ErrCode SignalBase<TInterface, Interfaces...>::enableKeepLastValue(Bool enabled)
 {
-    std::scoped_lock lock(this->sync);
-    keepLastPacket = enabled;
-    
-    if (!keepLastPacket)
-        lastDataPacket = nullptr;
+    DataPacketPtr previous;
+    {
+        std::scoped_lock lock(lastPacketLock);
+        keepLastPacket = enabled;
+        if (!enabled)
+            std::swap(lastDataPacket, previous);
+    }
+
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::getSentPacketCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = sentCounters.get(SentPackets);
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::getSentSampleCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = sentCounters.get(SentSamples);
+    return OPENDAQ_SUCCESS;
+}
+
+template <typename TInterface, typename... Interfaces>
+ErrCode SignalBase<TInterface, Interfaces...>::getSentByteCount(SizeT* bytes)
+{
+    OPENDAQ_PARAM_NOT_NULL(bytes);
+
+    *bytes = sentCounters.get(SentBytes);
     return OPENDAQ_SUCCESS;
 }
 
@@ -850,12 +1081,17 @@ template <typename TInterface, typename... Interfaces>
 ErrCode SignalBase<TInterface, Interfaces...>::getLastValue(IBaseObject ** value)
 {
     OPENDAQ_PARAM_NOT_NULL(value);
-    std::scoped_lock lock(this->sync);
 
-    if (!lastDataPacket.assigned() || lastDataPacket.getSampleCount() == 0)
+    DataPacketPtr dataPacket;
+    {
+        std::scoped_lock lock(lastPacketLock);
+        dataPacket = lastDataPacket;
+    }
+
+    if (!dataPacket.assigned() || dataPacket.getSampleCount() == 0)
         return OPENDAQ_IGNORED;
 
-    return lastDataPacket->getLastValue(value);
+    return dataPacket->getLastValue(value);
 }
 
 OPENDAQ_REGISTER_DESERIALIZE_FACTORY(SignalImpl)
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <coretypes/baseobject.h>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+/*!
+ * @ingroup opendaq_signals
+ * @addtogroup opendaq_signal Signal
+ * @{
+ */
+
+/*!
+ * @brief Provides the counters of packets sent through a Signal.
+ *
+ * The counters are always enabled and only include packets sent while the signal is active. They are kept
+ * per sending thread and summed when read, so reading them while packets are being sent returns a value
+ * that may lag behind by the packets currently in flight.
+ */
+DECLARE_OPENDAQ_INTERFACE(ISignalStatistics, IBaseObject)
+{
+    /*!
+     * @brief Gets the number of packets sent, including event packets.
+     * @param[out] count The number of packets sent since the signal was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getSentPacketCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the number of samples in all sent data packets.
+     * @param[out] count The number of samples sent since the signal was created.
+     */
+    virtual ErrCode INTERFACE_FUNC getSentSampleCount(SizeT* count) = 0;
+
+    /*!
+     * @brief Gets the raw data size of all sent data packets.
+     * @param[out] bytes The number of bytes sent since the signal was created. Samples of implicit
+     * (rule-based) signals are not counted, as they carry no raw data.
+     */
+    virtual ErrCode INTERFACE_FUNC getSentByteCount(SizeT* bytes) = 0;
+};
+/*!@}*/
+
+END_NAMESPACE_OPENDAQ
@@ -18,7 +18,12 @@
 #include <coretypes/common.h>
 #include <opendaq/sample_type.h>
 #include <opendaq/signal_ptr.h>
+#include <opendaq/signal_config_ptr.h>
 #include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/packet_ptr.h>
+#include <coretypes/listobject_factory.h>
+#include <utility>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -40,4 +45,34 @@ inline daq::ErrCode getSignalSampleType(const daq::SignalPtr& signal, daq::Sampl
     return descriptor->getSampleType(sampleType);
 }
 
+using SignalPackets = std::pair<SignalConfigPtr, ListPtr<IPacket>>;
+
+/*!
+ * @brief Sends a batch of packets on each of the given signals, for example the value and domain packets
+ * produced for several blocks of a channel.
+ * @param signalPackets The signals with the packets to be sent on each, in order.
+ *
+ * Every signal sends its packets with `sendPackets`, so each connection is locked and notified once per batch.
+ * A connection belongs to a single signal and an input port holds a single connection, so this is already one
+ * lock acquisition and one notification per receiving input port; there is nothing left to merge across signals.
+ * Empty batches are skipped. All batches are sent even if one of them fails; the first failure is returned.
+ */
+inline daq::ErrCode sendPacketsOnSignals(const std::vector<SignalPackets>& signalPackets)
+{
+    ErrCode result = OPENDAQ_SUCCESS;
+    for (const auto& [signal, packets] : signalPackets)
+    {
+        if (packets.assigned() && packets.getCount() == 0)
+            continue;
+
+        const ErrCode errCode = signal.assigned() && packets.assigned()
+            ? signal->sendPackets(packets)
+            : OPENDAQ_ERR_ARGUMENT_NULL;
+        if (OPENDAQ_FAILED(errCode) && OPENDAQ_SUCCEEDED(result))
+            result = errCode;
+    }
+
+    return result;
+}
+
 END_NAMESPACE_OPENDAQ
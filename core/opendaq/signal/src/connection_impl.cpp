@@ -3,25 +3,151 @@
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_ptr.h>
+#include <opendaq/signal_exceptions.h>
+#include <vector>
 
 BEGIN_NAMESPACE_OPENDAQ
 ConnectionImpl::ConnectionImpl(const InputPortPtr& port, const SignalPtr& signal, ContextPtr context)
     : port(port)
     , signalRef(signal)
     , context(std::move(context))
+    , highWaterMark(0)
+    , availableSamples(0)
+    , descriptorSegments{0}
 {
 }
 
-ErrCode ConnectionImpl::enqueue(IPacket* packet)
+void ConnectionImpl::getSampleAccounting(IPacket* packet, SizeT& sampleCount, bool& descriptorChanged)
 {
-    OPENDAQ_PARAM_NOT_NULL(packet);
+    sampleCount = 0;
+    descriptorChanged = false;
+
+    const auto packetPtr = PacketPtr::Borrow(packet);
+    switch (packetPtr.getType())
+    {
+        case PacketType::Data:
+        {
+            const auto dataPacket = packetPtr.asPtrOrNull<IDataPacket>(true);
+            if (dataPacket.assigned())
+                sampleCount = dataPacket.getSampleCount();
+            break;
+        }
+        case PacketType::Event:
+        {
+            const auto eventPacket = packetPtr.asPtrOrNull<IEventPacket>(true);
+            descriptorChanged = eventPacket.assigned() && eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED;
+            break;
+        }
+        case PacketType::None:
+            break;
+    }
+}
+
+ConnectionImpl::ConnectionImpl(const InputPortPtr& port,
+                               const SignalPtr& signal,
+                               ContextPtr context,
+                               SizeT capacity,
+                               QueueOverflowPolicy overflowPolicy)
+    : ConnectionImpl(port, signal, std::move(context))
+{
+    if (capacity == 0)
+        throw InvalidParameterException("Bounded connection capacity must be greater than 0");
+    if (overflowPolicy == QueueOverflowPolicy::Unbounded)
+        throw InvalidParameterException("Bounded connection requires an overflow policy");
+
+    boundedQueue = std::make_unique<BoundedPacketQueue>(capacity, overflowPolicy);
+}
+
+bool ConnectionImpl::enqueueInternal(IPacket* packet)
+{
+    SizeT sampleCount;
+    bool descriptorChanged;
+    getSampleAccounting(packet, sampleCount, descriptorChanged);
+
+    if (boundedQueue)
+        return boundedQueue->push(packet, sampleCount, descriptorChanged, [this] { return isAttachedToPort(); });
 
-    withLock([&packet, this]()
+    const auto now = std::chrono::steady_clock::now();
+    withLock([&packet, sampleCount, descriptorChanged, now, this]()
     {
         packets.emplace_back(packet);
+        enqueueTimes.push_back(now);
+        if (packets.size() > highWaterMark)
+            highWaterMark = packets.size();
+
+        availableSamples += sampleCount;
+        descriptorSegments.back() += sampleCount;
+        if (descriptorChanged)
+            descriptorSegments.push_back(0);
+    });
+
+    return true;
+}
+
+bool ConnectionImpl::enqueueMultipleInternal(const ListPtr<IPacket>& packets)
+{
+    const SizeT count = packets.getCount();
+
+    if (boundedQueue)
+    {
+        bool enqueued = false;
+        for (SizeT i = 0; i < count; ++i)
+            enqueued |= enqueueInternal(packets.getItemAt(i));
+        return enqueued;
+    }
+
+    struct PacketAccounting
+    {
+        PacketPtr packet;
+        SizeT sampleCount;
+        bool descriptorChanged;
+    };
+
+    std::vector<PacketAccounting> accounting;
+    accounting.reserve(count);
+    for (SizeT i = 0; i < count; ++i)
+    {
+        PacketAccounting entry{packets.getItemAt(i), 0, false};
+        getSampleAccounting(entry.packet, entry.sampleCount, entry.descriptorChanged);
+        accounting.push_back(std::move(entry));
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    withLock([&accounting, now, this]()
+    {
+        for (auto& entry : accounting)
+        {
+            packets.emplace_back(std::move(entry.packet));
+            enqueueTimes.push_back(now);
+
+            availableSamples += entry.sampleCount;
+            descriptorSegments.back() += entry.sampleCount;
+            if (entry.descriptorChanged)
+                descriptorSegments.push_back(0);
+        }
+
+        if (packets.size() > highWaterMark)
+            highWaterMark = packets.size();
     });
 
-    port.notifyPacketEnqueued();
+    return count > 0;
+}
+
+bool ConnectionImpl::isAttachedToPort() const
+{
+    // A producer blocked on a full queue gives up once the input port lets go of the connection,
+    // otherwise disconnecting would wait on the blocked producer forever.
+    const auto connection = port.getConnection();
+    return connection.assigned() && connection.getObject() == static_cast<const IConnection*>(this);
+}
+
+ErrCode ConnectionImpl::enqueue(IPacket* packet)
+{
+    OPENDAQ_PARAM_NOT_NULL(packet);
+
+    if (enqueueInternal(packet))
+        port.notifyPacketEnqueued();
+
     return OPENDAQ_SUCCESS;
 }
 
@@ -29,19 +155,38 @@ ErrCode INTERFACE_FUNC ConnectionImpl::enqueueOnThisThread(IPacket* packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
-    withLock([&packet, this]()
-    {
-        packets.emplace_back(packet);
-    });
+    if (enqueueInternal(packet))
+        port.notifyPacketEnqueuedOnThisThread();
 
-    port.notifyPacketEnqueuedOnThisThread();
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ConnectionImpl::enqueueMultiple(IList* packets)
+{
+    OPENDAQ_PARAM_NOT_NULL(packets);
+
+    return daqTry([&packets, this]()
+    {
+        if (enqueueMultipleInternal(ListPtr<IPacket>::Borrow(packets)))
+            port.notifyPacketEnqueued();
+    });
+}
+
 ErrCode ConnectionImpl::dequeue(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
+    if (boundedQueue)
+    {
+        std::chrono::steady_clock::time_point enqueueTime;
+        *packet = boundedQueue->pop(&enqueueTime);
+        if (*packet == nullptr)
+            return OPENDAQ_NO_MORE_ITEMS;
+
+        queueLatency.record(std::chrono::steady_clock::now() - enqueueTime);
+        return OPENDAQ_SUCCESS;
+    }
+
     return withLock([&packet, this]()
     {
         if (packets.empty())
@@ -50,9 +195,21 @@ ErrCode ConnectionImpl::dequeue(IPacket** packet)
             return OPENDAQ_NO_MORE_ITEMS;
         }
 
-        *packet = packets.front().addRefAndReturn();
+        *packet = packets.front().detach();
         packets.pop_front();
 
+        queueLatency.record(std::chrono::steady_clock::now() - enqueueTimes.front());
+        enqueueTimes.pop_front();
+
+        SizeT sampleCount;
+        bool descriptorChanged;
+        getSampleAccounting(*packet, sampleCount, descriptorChanged);
+
+        availableSamples -= sampleCount;
+        descriptorSegments.front() -= sampleCount;
+        if (descriptorChanged)
+            descriptorSegments.pop_front();
+
         return OPENDAQ_SUCCESS;
     });
 }
@@ -61,6 +218,12 @@ ErrCode ConnectionImpl::peek(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
 
+    if (boundedQueue)
+    {
+        *packet = boundedQueue->peek();
+        return *packet != nullptr ? OPENDAQ_SUCCESS : OPENDAQ_NO_MORE_ITEMS;
+    }
+
     return withLock([&packet, this]()
     {
         if (packets.empty())
@@ -78,6 +241,12 @@ ErrCode ConnectionImpl::getPacketCount(SizeT* packetCount)
 {
     OPENDAQ_PARAM_NOT_NULL(packetCount);
 
+    if (boundedQueue)
+    {
+        *packetCount = boundedQueue->size();
+        return OPENDAQ_SUCCESS;
+    }
+
     return withLock([&packetCount, this]()
     {
         *packetCount = packets.size();
@@ -89,21 +258,15 @@ ErrCode ConnectionImpl::getAvailableSamples(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]()
+    if (boundedQueue)
     {
-        *samples = 0;
-        for (const auto& packet : packets)
-        {
-            if (packet.getType() == PacketType::Data)
-            {
-                auto dataPacket = packet.template asPtrOrNull<IDataPacket>(true);
-                if (dataPacket.assigned())
-                {
-                    *samples += dataPacket.getSampleCount();
-                }
-            }
-        }
+        *samples = boundedQueue->getAvailableSamples();
+        return OPENDAQ_SUCCESS;
+    }
 
+    return withLock([samples, this]()
+    {
+        *samples = availableSamples;
         return OPENDAQ_SUCCESS;
     });
 }
@@ -112,35 +275,15 @@ ErrCode ConnectionImpl::getSamplesUntilNextDescriptor(SizeT* samples)
 {
     OPENDAQ_PARAM_NOT_NULL(samples);
 
-    return withLock([samples, this]() {
-        *samples = 0;
-        for (const auto& packet : packets)
-        {
-            switch (packet.getType())
-            {
-                case PacketType::Data:
-                {
-                    auto dataPacket = packet.template asPtrOrNull<IDataPacket>(true);
-                    if (dataPacket.assigned())
-                    {
-                        *samples += dataPacket.getSampleCount();
-                    }
-                    break;
-                }
-                case PacketType::Event:
-                {
-                    auto eventPacket = packet.template asPtrOrNull<IEventPacket>(true);
-                    if (eventPacket.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
-                    {
-                        return OPENDAQ_SUCCESS;
-                    }
-                    break;
-                }
-                case PacketType::None:
-                    break;
-            }
-        }
+    if (boundedQueue)
+    {
+        *samples = boundedQueue->getSamplesUntilNextDescriptor();
+        return OPENDAQ_SUCCESS;
+    }
 
+    return withLock([samples, this]()
+    {
+        *samples = descriptorSegments.front();
         return OPENDAQ_SUCCESS;
     });
 }
@@ -171,6 +314,69 @@ ErrCode ConnectionImpl::getInputPort(IInputPort** inputPort)
     return OPENDAQ_SUCCESS;
 }
 
+ErrCode ConnectionImpl::getQueueCapacity(SizeT* capacity)
+{
+    OPENDAQ_PARAM_NOT_NULL(capacity);
+
+    *capacity = boundedQueue ? boundedQueue->getCapacity() : 0;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ConnectionImpl::getOverflowPolicy(QueueOverflowPolicy* policy)
+{
+    OPENDAQ_PARAM_NOT_NULL(policy);
+
+    *policy = boundedQueue ? boundedQueue->getPolicy() : QueueOverflowPolicy::Unbounded;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ConnectionImpl::getDroppedPacketCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = boundedQueue ? boundedQueue->getDroppedCount() : 0;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode ConnectionImpl::getHighWaterMark(SizeT* highWaterMark)
+{
+    OPENDAQ_PARAM_NOT_NULL(highWaterMark);
+
+    if (boundedQueue)
+    {
+        *highWaterMark = boundedQueue->getHighWaterMark();
+        return OPENDAQ_SUCCESS;
+    }
+
+    return withLock([&highWaterMark, this]()
+    {
+        *highWaterMark = this->highWaterMark;
+        return OPENDAQ_SUCCESS;
+    });
+}
+
+ErrCode ConnectionImpl::getQueueLatencyHistogram(IList** bucketCounts)
+{
+    OPENDAQ_PARAM_NOT_NULL(bucketCounts);
+
+    return daqTry([&bucketCounts, this]()
+    {
+        auto counts = List<IInteger>();
+        for (std::size_t i = 0; i < LatencyHistogram::BucketCount; ++i)
+            counts.pushBack(static_cast<Int>(queueLatency.getBucket(i)));
+
+        *bucketCounts = counts.detach();
+    });
+}
+
+ErrCode ConnectionImpl::getLatePacketCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = queueLatency.getOverflowCount();
+    return OPENDAQ_SUCCESS;
+}
+
 const std::deque<PacketPtr>& ConnectionImpl::getPackets() const noexcept
 {
     return packets;
@@ -187,4 +393,21 @@ OPENDAQ_DEFINE_CLASS_FACTORY(
     context
 )
 
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
+    LIBRARY_FACTORY,
+    ConnectionImpl,
+    IConnection,
+    createBoundedConnection,
+    IInputPort*,
+    inputPort,
+    ISignal*,
+    signal,
+    IContext*,
+    context,
+    SizeT,
+    capacity,
+    QueueOverflowPolicy,
+    overflowPolicy
+)
+
 END_NAMESPACE_OPENDAQ
@@ -22,4 +22,15 @@ OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
     IAllocator*, allocator
 )
 
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE_AND_CREATEFUNC_OBJ(
+    LIBRARY_FACTORY, DataPacketImpl<IDataPacket>,
+    IDataPacket, createDataPacketWithScaledDataAllocator,
+    IDataPacket*, domainPacket,
+    IDataDescriptor*, descriptor,
+    SizeT, sampleCount,
+    INumber*, offset,
+    IAllocator*, allocator,
+    IAllocator*, scaledDataAllocator
+)
+
 END_NAMESPACE_OPENDAQ
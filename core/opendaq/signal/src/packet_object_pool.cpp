@@ -0,0 +1,330 @@
+#include <opendaq/packet_object_pool.h>
+#include <coretypes/impl.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+namespace
+{
+
+constexpr std::size_t MaxPooledSizes = 4;
+constexpr std::size_t ThreadCacheCapacity = 64;
+constexpr std::size_t TransferBatchSize = ThreadCacheCapacity / 2;
+constexpr std::size_t MaxSharedObjectsPerSize = 1024;
+
+struct ThreadCache;
+
+struct SharedFreeList
+{
+    std::size_t size = 0;
+    std::vector<void*> objects;
+};
+
+struct SharedPool
+{
+    std::mutex sync;
+    SharedFreeList freeLists[MaxPooledSizes];
+    std::vector<ThreadCache*> threadCaches;
+    SizeT retiredHitCount = 0;
+    SizeT retiredMissCount = 0;
+};
+
+// intentionally leaked, packets can outlive static destruction
+SharedPool& getSharedPool()
+{
+    static SharedPool* pool = new SharedPool();
+    return *pool;
+}
+
+SharedFreeList* findSharedFreeList(SharedPool& pool, std::size_t size)
+{
+    for (auto& freeList : pool.freeLists)
+    {
+        if (freeList.size == size)
+            return &freeList;
+
+        if (freeList.size == 0)
+        {
+            freeList.size = size;
+            freeList.objects.reserve(MaxSharedObjectsPerSize);
+            return &freeList;
+        }
+    }
+
+    return nullptr;
+}
+
+// Pushes objects to the shared free list of their size and returns how many of them were accepted.
+std::size_t pushShared(SharedPool& pool, std::size_t size, void* const* objects, std::size_t count)
+{
+    std::scoped_lock lock(pool.sync);
+
+    const auto freeList = findSharedFreeList(pool, size);
+    if (freeList == nullptr)
+        return 0;
+
+    const auto accepted = std::min(count, MaxSharedObjectsPerSize - freeList->objects.size());
+    freeList->objects.insert(freeList->objects.end(), objects, objects + accepted);
+    return accepted;
+}
+
+// Pops up to `count` objects of the given size from the shared free list and returns how many were taken.
+std::size_t popShared(SharedPool& pool, std::size_t size, void** objects, std::size_t count)
+{
+    std::scoped_lock lock(pool.sync);
+
+    const auto freeList = findSharedFreeList(pool, size);
+    if (freeList == nullptr)
+        return 0;
+
+    const auto taken = std::min(count, freeList->objects.size());
+    const auto first = freeList->objects.end() - static_cast<std::ptrdiff_t>(taken);
+    std::copy(first, freeList->objects.end(), objects);
+    freeList->objects.erase(first, freeList->objects.end());
+    return taken;
+}
+
+// Set when the cache of the thread was destroyed; trivially destructible so that it stays valid for packets
+// released later during thread exit.
+thread_local bool threadCacheDestroyed = false;
+
+struct ThreadCache
+{
+    struct FreeList
+    {
+        std::size_t size = 0;
+        std::size_t count = 0;
+        void* objects[ThreadCacheCapacity];
+    };
+
+    FreeList freeLists[MaxPooledSizes];
+
+    // written only by the owning thread, read by the statistics
+    std::atomic<SizeT> hitCount{0};
+    std::atomic<SizeT> missCount{0};
+    std::atomic<SizeT> pooledBytes{0};
+
+    ThreadCache()
+    {
+        auto& pool = getSharedPool();
+        std::scoped_lock lock(pool.sync);
+        pool.threadCaches.push_back(this);
+    }
+
+    ~ThreadCache()
+    {
+        auto& pool = getSharedPool();
+        for (auto& freeList : freeLists)
+        {
+            if (freeList.count == 0)
+                continue;
+
+            const auto accepted = pushShared(pool, freeList.size, freeList.objects, freeList.count);
+            for (std::size_t i = accepted; i < freeList.count; ++i)
+                ::operator delete(freeList.objects[i]);
+        }
+
+        {
+            std::scoped_lock lock(pool.sync);
+            pool.threadCaches.erase(std::remove(pool.threadCaches.begin(), pool.threadCaches.end(), this), pool.threadCaches.end());
+            pool.retiredHitCount += hitCount.load(std::memory_order_relaxed);
+            pool.retiredMissCount += missCount.load(std::memory_order_relaxed);
+        }
+
+        threadCacheDestroyed = true;
+    }
+
+    FreeList* findFreeList(std::size_t size)
+    {
+        for (auto& freeList : freeLists)
+        {
+            if (freeList.size == size)
+                return &freeList;
+
+            if (freeList.size == 0)
+            {
+                freeList.size = size;
+                return &freeList;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static void increment(std::atomic<SizeT>& counter, SizeT value = 1)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+    static void decrement(std::atomic<SizeT>& counter, SizeT value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) - value, std::memory_order_relaxed);
+    }
+};
+
+ThreadCache& getThreadCache()
+{
+    thread_local ThreadCache cache;
+    return cache;
+}
+
+void* allocateShared(std::size_t size)
+{
+    auto& pool = getSharedPool();
+    {
+        std::scoped_lock lock(pool.sync);
+
+        const auto freeList = findSharedFreeList(pool, size);
+        if (freeList && !freeList->objects.empty())
+        {
+            void* address = freeList->objects.back();
+            freeList->objects.pop_back();
+            ++pool.retiredHitCount;
+            return address;
+        }
+
+        ++pool.retiredMissCount;
+    }
+
+    return ::operator new(size);
+}
+
+void releaseShared(void* address, std::size_t size) noexcept
+{
+    if (pushShared(getSharedPool(), size, &address, 1) == 0)
+        ::operator delete(address);
+}
+
+}
+
+void* PacketObjectPool::allocate(std::size_t size)
+{
+    if (threadCacheDestroyed)
+        return allocateShared(size);
+
+    auto& cache = getThreadCache();
+    const auto freeList = cache.findFreeList(size);
+    if (freeList != nullptr)
+    {
+        if (freeList->count == 0)
+        {
+            freeList->count = popShared(getSharedPool(), size, freeList->objects, TransferBatchSize);
+            ThreadCache::increment(cache.pooledBytes, freeList->count * size);
+        }
+
+        if (freeList->count != 0)
+        {
+            ThreadCache::increment(cache.hitCount);
+            ThreadCache::decrement(cache.pooledBytes, size);
+            return freeList->objects[--freeList->count];
+        }
+    }
+
+    ThreadCache::increment(cache.missCount);
+    return ::operator new(size);
+}
+
+void PacketObjectPool::release(void* address, std::size_t size) noexcept
+{
+    if (address == nullptr)
+        return;
+
+    if (threadCacheDestroyed)
+    {
+        releaseShared(address, size);
+        return;
+    }
+
+    auto& cache = getThreadCache();
+    const auto freeList = cache.findFreeList(size);
+    if (freeList == nullptr)
+    {
+        ::operator delete(address);
+        return;
+    }
+
+    if (freeList->count == ThreadCacheCapacity)
+    {
+        // hand the older half over to the threads that allocate packets of this size
+        auto batch = freeList->objects;
+        const auto accepted = pushShared(getSharedPool(), size, batch, TransferBatchSize);
+        for (std::size_t i = accepted; i < TransferBatchSize; ++i)
+            ::operator delete(batch[i]);
+
+        std::copy(freeList->objects + TransferBatchSize, freeList->objects + ThreadCacheCapacity, freeList->objects);
+        freeList->count -= TransferBatchSize;
+        ThreadCache::decrement(cache.pooledBytes, TransferBatchSize * size);
+    }
+
+    freeList->objects[freeList->count++] = address;
+    ThreadCache::increment(cache.pooledBytes, size);
+}
+
+SizeT PacketObjectPool::getHitCount()
+{
+    auto& pool = getSharedPool();
+    std::scoped_lock lock(pool.sync);
+
+    SizeT count = pool.retiredHitCount;
+    for (const auto cache : pool.threadCaches)
+        count += cache->hitCount.load(std::memory_order_relaxed);
+    return count;
+}
+
+SizeT PacketObjectPool::getMissCount()
+{
+    auto& pool = getSharedPool();
+    std::scoped_lock lock(pool.sync);
+
+    SizeT count = pool.retiredMissCount;
+    for (const auto cache : pool.threadCaches)
+        count += cache->missCount.load(std::memory_order_relaxed);
+    return count;
+}
+
+SizeT PacketObjectPool::getPooledBytes()
+{
+    auto& pool = getSharedPool();
+    std::scoped_lock lock(pool.sync);
+
+    SizeT bytes = 0;
+    for (const auto& freeList : pool.freeLists)
+        bytes += freeList.size * freeList.objects.size();
+    for (const auto cache : pool.threadCaches)
+        bytes += cache->pooledBytes.load(std::memory_order_relaxed);
+    return bytes;
+}
+
+ErrCode PacketObjectPoolStatisticsImpl::getHitCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = PacketObjectPool::getHitCount();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketObjectPoolStatisticsImpl::getMissCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    *count = PacketObjectPool::getMissCount();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PacketObjectPoolStatisticsImpl::getPooledBytes(SizeT* bytes)
+{
+    OPENDAQ_PARAM_NOT_NULL(bytes);
+
+    *bytes = PacketObjectPool::getPooledBytes();
+    return OPENDAQ_SUCCESS;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PacketObjectPoolStatistics,
+    IAllocatorStatistics)
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,178 @@
+#include <opendaq/pool_allocator_impl.h>
+#include <coretypes/common.h>
+#include <coretypes/impl.h>
+#include <cstdint>
+#include <limits>
+
+BEGIN_NAMESPACE_OPENDAQ
+
+PoolAllocatorImpl::PoolAllocatorImpl(SizeT maxPooledBytes)
+    : maxPooledBytes(maxPooledBytes)
+    , pooledBytes(0)
+    , hitCount(0)
+    , missCount(0)
+{
+}
+
+PoolAllocatorImpl::~PoolAllocatorImpl()
+{
+    for (auto& blocks : freeLists)
+        for (auto block : blocks)
+            std::free(block);
+}
+
+SizeT PoolAllocatorImpl::getSizeClass(SizeT bytes)
+{
+    SizeT sizeClass = MinSizeClass;
+    while (sizeClass < SizeClassCount - 1 && getClassSize(sizeClass) < bytes)
+        ++sizeClass;
+    return sizeClass;
+}
+
+SizeT PoolAllocatorImpl::getClassSize(SizeT sizeClass)
+{
+    return SizeT(1) << sizeClass;
+}
+
+SizeT PoolAllocatorImpl::getAlignment(SizeT align)
+{
+    // the alignment requirement of an element of the given size is the largest power of two that divides it
+    return align & (~align + 1);
+}
+
+PoolAllocatorImpl::BlockHeader* PoolAllocatorImpl::allocateOverAligned(SizeT bytes, SizeT alignment)
+{
+    if (bytes > std::numeric_limits<SizeT>::max() - sizeof(BlockHeader) - alignment)
+        return nullptr;
+
+    void* base = std::malloc(sizeof(BlockHeader) + alignment + bytes);
+    if (base == nullptr)
+        return nullptr;
+
+    const auto payload = (reinterpret_cast<std::uintptr_t>(base) + sizeof(BlockHeader) + alignment - 1) & ~(alignment - 1);
+    const auto block = reinterpret_cast<BlockHeader*>(payload) - 1;
+    block->sizeClass = OverAlignedClass;
+    block->base = base;
+    return block;
+}
+
+ErrCode PoolAllocatorImpl::allocate(
+    const IDataDescriptor *descriptor,
+    SizeT bytes,
+    SizeT align,
+    VoidPtr* address)
+{
+    OPENDAQ_PARAM_NOT_NULL(address);
+
+    *address = nullptr;
+
+    const SizeT alignment = getAlignment(align);
+    if (alignment > alignof(BlockHeader))
+    {
+        {
+            std::scoped_lock lock(sync);
+            ++missCount;
+        }
+
+        const auto block = allocateOverAligned(bytes, alignment);
+        if (block == nullptr)
+            return makeErrorInfo(OPENDAQ_ERR_NOMEMORY, "Pool allocator failed to allocate an over-aligned block");
+
+        *address = block + 1;
+        return OPENDAQ_SUCCESS;
+    }
+
+    const SizeT sizeClass = getSizeClass(bytes);
+    const SizeT classSize = getClassSize(sizeClass);
+    if (classSize < bytes)
+        return makeErrorInfo(OPENDAQ_ERR_NOMEMORY, "Pool allocator request exceeds the largest size class");
+
+    {
+        std::scoped_lock lock(sync);
+
+        auto& blocks = freeLists[sizeClass];
+        if (!blocks.empty())
+        {
+            BlockHeader* block = blocks.back();
+            blocks.pop_back();
+            pooledBytes -= classSize;
+            ++hitCount;
+
+            *address = block + 1;
+            return OPENDAQ_SUCCESS;
+        }
+
+        ++missCount;
+    }
+
+    const auto block = static_cast<BlockHeader*>(std::malloc(sizeof(BlockHeader) + classSize));
+    if (block == nullptr)
+        return makeErrorInfo(OPENDAQ_ERR_NOMEMORY, "Pool allocator failed to allocate a block");
+
+    block->sizeClass = sizeClass;
+    *address = block + 1;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::free(VoidPtr address)
+{
+    if (address == nullptr)
+        return OPENDAQ_SUCCESS;
+
+    const auto block = static_cast<BlockHeader*>(address) - 1;
+    if (block->sizeClass == OverAlignedClass)
+    {
+        std::free(block->base);
+        return OPENDAQ_SUCCESS;
+    }
+
+    const SizeT classSize = getClassSize(block->sizeClass);
+
+    {
+        std::scoped_lock lock(sync);
+
+        if (pooledBytes + classSize <= maxPooledBytes)
+        {
+            freeLists[block->sizeClass].push_back(block);
+            pooledBytes += classSize;
+            return OPENDAQ_SUCCESS;
+        }
+    }
+
+    std::free(block);
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getHitCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = hitCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getMissCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = missCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode PoolAllocatorImpl::getPooledBytes(SizeT* bytes)
+{
+    OPENDAQ_PARAM_NOT_NULL(bytes);
+
+    std::scoped_lock lock(sync);
+    *bytes = pooledBytes;
+    return OPENDAQ_SUCCESS;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, PoolAllocator,
+    IAllocator,
+    SizeT, maxPooledBytes)
+
+END_NAMESPACE_OPENDAQ
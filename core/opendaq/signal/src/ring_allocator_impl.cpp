@@ -0,0 +1,294 @@
+#include <opendaq/ring_allocator_impl.h>
+#include <coretypes/common.h>
+#include <coretypes/impl.h>
+#include <algorithm>
+#include <new>
+
+#if defined(__linux__)
+    #include <sys/mman.h>
+#endif
+
+BEGIN_NAMESPACE_OPENDAQ
+
+RingAllocatorImpl::RingAllocatorImpl(SizeT capacity, SizeT timeoutMs, Bool useHugePages, Bool heapFallback)
+    : buffer(nullptr)
+    , capacity(roundUp(capacity))
+    , timeout(timeoutMs)
+    , heapFallback(heapFallback)
+    , mapped(false)
+    , head(0)
+    , tail(0)
+    , used(0)
+    , hitCount(0)
+    , missCount(0)
+{
+    if (this->capacity == 0)
+        throw InvalidParameterException("Ring allocator capacity must be greater than zero.");
+
+    allocateBuffer(useHugePages);
+}
+
+RingAllocatorImpl::~RingAllocatorImpl()
+{
+    freeBuffer();
+}
+
+void RingAllocatorImpl::allocateBuffer(bool useHugePages)
+{
+#if defined(__linux__)
+    if (useHugePages)
+    {
+        void* memory = mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+    #if defined(MADV_HUGEPAGE)
+            madvise(memory, capacity, MADV_HUGEPAGE);
+    #endif
+            buffer = static_cast<uint8_t*>(memory);
+            mapped = true;
+            return;
+        }
+    }
+#endif
+
+    buffer = static_cast<uint8_t*>(::operator new(capacity, std::align_val_t(SliceAlignment)));
+}
+
+void RingAllocatorImpl::freeBuffer()
+{
+#if defined(__linux__)
+    if (mapped)
+    {
+        munmap(buffer, capacity);
+        return;
+    }
+#endif
+
+    ::operator delete(buffer, std::align_val_t(SliceAlignment));
+}
+
+SizeT RingAllocatorImpl::roundUp(SizeT bytes)
+{
+    return (bytes + SliceAlignment - 1) / SliceAlignment * SliceAlignment;
+}
+
+RingAllocatorImpl::SliceHeader* RingAllocatorImpl::headerAt(SizeT position) const
+{
+    return reinterpret_cast<SliceHeader*>(buffer + position);
+}
+
+bool RingAllocatorImpl::isInRing(const void* address) const
+{
+    const auto byteAddress = static_cast<const uint8_t*>(address);
+    return byteAddress >= buffer && byteAddress < buffer + capacity;
+}
+
+RingAllocatorImpl::SliceHeader* RingAllocatorImpl::reserve(SizeT size)
+{
+    SizeT position;
+    if (used == 0)
+    {
+        head = 0;
+        tail = 0;
+        position = 0;
+    }
+    else if (head > tail)
+    {
+        // free space is [head, capacity) followed by [0, tail)
+        if (capacity - head >= size)
+        {
+            position = head;
+        }
+        else if (tail >= size)
+        {
+            if (head < capacity)
+            {
+                SliceHeader* padding = headerAt(head);
+                padding->size = capacity - head;
+                padding->released = true;
+                used += padding->size;
+            }
+            position = 0;
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+    else
+    {
+        // free space is [head, tail)
+        if (tail - head < size)
+            return nullptr;
+        position = head;
+    }
+
+    SliceHeader* slice = headerAt(position);
+    slice->size = size;
+    slice->released = false;
+
+    head = position + size;
+    used += size;
+    return slice;
+}
+
+SizeT RingAllocatorImpl::getAlignment(SizeT align)
+{
+    // the alignment requirement of an element of the given size is the largest power of two that divides it
+    return align & (~align + 1);
+}
+
+void* RingAllocatorImpl::allocateFromHeap(SizeT bytes, SizeT alignment)
+{
+    // the address of the heap block is stored in front of the aligned address
+    alignment = std::max(alignment, SliceAlignment);
+    const auto base = static_cast<uint8_t*>(std::malloc(bytes + alignment + sizeof(void*)));
+    if (base == nullptr)
+        return nullptr;
+
+    const auto address = reinterpret_cast<uintptr_t>(base + sizeof(void*));
+    const auto aligned = reinterpret_cast<void**>((address + alignment - 1) / alignment * alignment);
+    aligned[-1] = base;
+    return aligned;
+}
+
+void RingAllocatorImpl::freeFromHeap(void* address)
+{
+    std::free(static_cast<void**>(address)[-1]);
+}
+
+ErrCode RingAllocatorImpl::allocate(
+    const IDataDescriptor *descriptor,
+    SizeT bytes,
+    SizeT align,
+    VoidPtr* address)
+{
+    OPENDAQ_PARAM_NOT_NULL(address);
+
+    *address = nullptr;
+    const SizeT alignment = getAlignment(align);
+
+    // empty slices still get a payload, so that every slice address lies inside of the ring buffer
+    const SizeT payload = roundUp(std::max<SizeT>(bytes, 1));
+    const bool fitsRing = alignment <= SliceAlignment && bytes <= capacity && sizeof(SliceHeader) + payload <= capacity;
+    if (!fitsRing && !heapFallback)
+    {
+        if (alignment > SliceAlignment)
+            return makeErrorInfo(OPENDAQ_ERR_INVALIDPARAMETER, "Ring allocator slices are aligned to at most 64 bytes");
+        return OPENDAQ_SUCCESS;
+    }
+
+    {
+        std::unique_lock lock(sync);
+
+        if (fitsRing)
+        {
+            const SizeT size = sizeof(SliceHeader) + payload;
+            SliceHeader* slice = nullptr;
+
+            spaceReleased.wait_for(lock,
+                                   timeout,
+                                   [&]
+                                   {
+                                       slice = reserve(size);
+                                       return slice != nullptr;
+                                   });
+
+            if (slice != nullptr)
+            {
+                ++hitCount;
+                *address = slice + 1;
+                return OPENDAQ_SUCCESS;
+            }
+        }
+
+        if (!heapFallback)
+            return OPENDAQ_SUCCESS;
+
+        ++missCount;
+    }
+
+    *address = allocateFromHeap(bytes, alignment);
+    if (*address == nullptr)
+        return makeErrorInfo(OPENDAQ_ERR_NOMEMORY, "Ring allocator heap fallback failed");
+
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode RingAllocatorImpl::free(VoidPtr address)
+{
+    if (address == nullptr)
+        return OPENDAQ_SUCCESS;
+
+    if (!isInRing(address))
+    {
+        freeFromHeap(address);
+        return OPENDAQ_SUCCESS;
+    }
+
+    SliceHeader* slice = static_cast<SliceHeader*>(address) - 1;
+    bool reclaimed = false;
+
+    {
+        std::scoped_lock lock(sync);
+
+        slice->released = true;
+        while (used > 0)
+        {
+            if (tail == capacity)
+                tail = 0;
+
+            const SliceHeader* oldest = headerAt(tail);
+            if (!oldest->released)
+                break;
+
+            tail += oldest->size;
+            used -= oldest->size;
+            reclaimed = true;
+        }
+
+        if (tail == capacity)
+            tail = 0;
+    }
+
+    if (reclaimed)
+        spaceReleased.notify_all();
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode RingAllocatorImpl::getHitCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = hitCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode RingAllocatorImpl::getMissCount(SizeT* count)
+{
+    OPENDAQ_PARAM_NOT_NULL(count);
+
+    std::scoped_lock lock(sync);
+    *count = missCount;
+    return OPENDAQ_SUCCESS;
+}
+
+ErrCode RingAllocatorImpl::getPooledBytes(SizeT* bytes)
+{
+    OPENDAQ_PARAM_NOT_NULL(bytes);
+
+    std::scoped_lock lock(sync);
+    *bytes = capacity - used;
+    return OPENDAQ_SUCCESS;
+}
+
+OPENDAQ_DEFINE_CLASS_FACTORY_WITH_INTERFACE(
+    LIBRARY_FACTORY, RingAllocator,
+    IAllocator,
+    SizeT, capacity,
+    SizeT, timeoutMs,
+    Bool, useHugePages,
+    Bool, heapFallback)
+
+END_NAMESPACE_OPENDAQ
@@ -8,6 +8,21 @@ BEGIN_NAMESPACE_OPENDAQ
 namespace detail
 {
     static const StructTypePtr scalingStructType = ScalingStructType();
+
+    static ListPtr<IBaseObject> getNumberList(const DictPtr<IString, IBaseObject>& params, const StringPtr& key)
+    {
+        const auto list = params.get(key).asPtrOrNull<IList>();
+        if (!list.assigned())
+            return nullptr;
+
+        for (const auto& item : list)
+        {
+            if (!item.asPtrOrNull<INumber>().assigned())
+                return nullptr;
+        }
+
+        return list;
+    }
 }
 
 DictPtr<IString, IBaseObject> ScalingImpl::PackBuilder(IScalingBuilder* scalingBuilder)
@@ -202,6 +217,48 @@ ErrCode ScalingImpl::verifyParametersInternal() const
         if (!params.get("scale").asPtrOrNull<INumber>().assigned() || !params.get("offset").asPtrOrNull<INumber>().assigned())
             return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS, "Linear scaling parameters must be numbers.");
     }
+    else if (ruleType == ScalingType::Polynomial)
+    {
+        if (params.getCount() != 1 || !params.hasKey("coefficients"))
+        {
+            return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS,
+                                 R"(Polynomial scaling has invalid parameters. Required parameter is "coefficients".)");
+        }
+
+        const auto coefficients = detail::getNumberList(params, "coefficients");
+        if (!coefficients.assigned())
+            return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS, "Polynomial scaling coefficients must be a list of numbers.");
+
+        if (coefficients.getCount() < 1 || coefficients.getCount() > 6)
+            return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS, "Polynomial scaling must have between 1 and 6 coefficients.");
+    }
+    else if (ruleType == ScalingType::LookupTable)
+    {
+        if (params.getCount() != 2 || !params.hasKey("input") || !params.hasKey("output"))
+        {
+            return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS,
+                                 R"(Lookup table scaling has invalid parameters. Required parameters are "input" and "output".)");
+        }
+
+        const auto input = detail::getNumberList(params, "input");
+        const auto output = detail::getNumberList(params, "output");
+        if (!input.assigned() || !output.assigned())
+            return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS, "Lookup table scaling parameters must be lists of numbers.");
+
+        if (input.getCount() < 2 || input.getCount() != output.getCount())
+        {
+            return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS,
+                                 "Lookup table scaling input and output must have the same number of entries, at least two.");
+        }
+
+        for (SizeT i = 1; i < input.getCount(); ++i)
+        {
+            const Float previous = input[i - 1];
+            const Float current = input[i];
+            if (!(current > previous))
+                return makeErrorInfo(OPENDAQ_ERR_INVALID_PARAMETERS, "Lookup table scaling input values must be strictly increasing.");
+        }
+    }
 
     return OPENDAQ_SUCCESS;
 }
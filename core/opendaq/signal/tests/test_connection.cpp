@@ -1,6 +1,14 @@
 #include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include <opendaq/connection_factory.h>
+#include <opendaq/connection_statistics_ptr.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/metric_counters.h>
+#include <opendaq/packet_factory.h>
 #include <coretypes/objectptr.h>
+#include <coretypes/listobject_factory.h>
 #include <gtest/gtest.h>
 #include "opendaq/gmock/context.h"
 #include "opendaq/gmock/input_port.h"
@@ -66,3 +74,333 @@ TEST_F(ConnectionTest, PeekEmpty)
 {
     ASSERT_FALSE(connection.peek().assigned());
 }
+
+TEST_F(ConnectionTest, SampleAccounting)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(4);
+    connection.enqueue(DataPacket(descriptor, 10));
+    connection.enqueue(DataPacket(descriptor, 5));
+    connection.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+    connection.enqueue(DataPacket(descriptor, 7));
+
+    ASSERT_EQ(connection.getAvailableSamples(), 22u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 15u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getAvailableSamples(), 12u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 5u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getAvailableSamples(), 7u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 7u);
+
+    connection.dequeue();
+    ASSERT_EQ(connection.getAvailableSamples(), 0u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 0u);
+}
+
+TEST_F(ConnectionTest, EnqueueMultiple)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    const auto packets = List<IPacket>(DataPacket(descriptor, 10),
+                                       DataDescriptorChangedEventPacket(descriptor, nullptr),
+                                       DataPacket(descriptor, 7));
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(1);
+    connection.enqueueMultiple(packets);
+
+    ASSERT_EQ(connection.getPacketCount(), 3u);
+    ASSERT_EQ(connection.getAvailableSamples(), 17u);
+    ASSERT_EQ(connection.getSamplesUntilNextDescriptor(), 10u);
+
+    for (const auto& packet : packets)
+        ASSERT_EQ(connection.dequeue(), packet);
+}
+
+TEST_F(ConnectionTest, EnqueueMultipleEmpty)
+{
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(0);
+    connection.enqueueMultiple(List<IPacket>());
+
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+}
+
+TEST_F(ConnectionTest, EnqueueMultipleInvalidItem)
+{
+    const auto items = List<IBaseObject>(Integer(1));
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(0);
+    ASSERT_TRUE(OPENDAQ_FAILED(connection->enqueueMultiple(items)));
+    ASSERT_EQ(connection.getPacketCount(), 0u);
+}
+
+class BoundedConnectionTest : public ConnectionTest
+{
+protected:
+    static std::array<PacketPtr, 4> createPackets()
+    {
+        return {
+            createWithImplementation<IPacket, MockPacket>(),
+            createWithImplementation<IPacket, MockPacket>(),
+            createWithImplementation<IPacket, MockPacket>(),
+            createWithImplementation<IPacket, MockPacket>(),
+        };
+    }
+
+    ConnectionPtr createBounded(SizeT capacity, QueueOverflowPolicy policy)
+    {
+        return BoundedConnection(inputPort->asPtr<IInputPort>(), signal, context, capacity, policy);
+    }
+};
+
+TEST_F(BoundedConnectionTest, ZeroCapacity)
+{
+    ASSERT_THROW(createBounded(0, QueueOverflowPolicy::DropOldest), InvalidParameterException);
+    ASSERT_THROW(createBounded(4, QueueOverflowPolicy::Unbounded), InvalidParameterException);
+}
+
+TEST_F(BoundedConnectionTest, UnboundedStatistics)
+{
+    auto stats = connection.asPtr<IConnectionStatistics>();
+    ASSERT_EQ(stats.getQueueCapacity(), 0u);
+    ASSERT_EQ(stats.getOverflowPolicy(), QueueOverflowPolicy::Unbounded);
+    ASSERT_EQ(stats.getDroppedPacketCount(), 0u);
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(2);
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+    connection.enqueue(createWithImplementation<IPacket, MockPacket>());
+    connection.dequeue();
+
+    ASSERT_EQ(stats.getHighWaterMark(), 2u);
+}
+
+TEST_F(BoundedConnectionTest, QueueLatencyHistogram)
+{
+    auto bounded = createBounded(4, QueueOverflowPolicy::DropOldest);
+    auto packets = createPackets();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(8);
+    for (auto& conn : {connection, bounded})
+    {
+        auto stats = conn.asPtr<IConnectionStatistics>();
+
+        conn.enqueue(packets[0]);
+        conn.enqueue(packets[1]);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        conn.dequeue();
+        conn.dequeue();
+
+        // Packets that are still queued or were dropped are not timed
+        conn.enqueue(packets[2]);
+        conn.enqueue(packets[3]);
+
+        auto histogram = stats.getQueueLatencyHistogram();
+        ASSERT_EQ(histogram.getCount(), LatencyHistogram::BucketCount);
+
+        SizeT timed = 0;
+        for (SizeT i = 0; i < histogram.getCount(); ++i)
+        {
+            // Both packets waited at least 2 ms, i.e. landed in or above the [1024, 2048) us bucket
+            if (i <= 10)
+                ASSERT_EQ(histogram.getItemAt(i), 0);
+            timed += static_cast<SizeT>(histogram.getItemAt(i));
+        }
+
+        ASSERT_EQ(timed, 2u);
+        ASSERT_EQ(stats.getLatePacketCount(), 0u);
+    }
+}
+
+TEST_F(BoundedConnectionTest, EnqueueDequeue)
+{
+    auto bounded = createBounded(4, QueueOverflowPolicy::DropOldest);
+    auto packets = createPackets();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(4);
+    for (const auto& packet : packets)
+        bounded.enqueue(packet);
+
+    ASSERT_EQ(bounded.getPacketCount(), 4u);
+    ASSERT_EQ(bounded.peek(), packets[0]);
+
+    for (const auto& packet : packets)
+        ASSERT_EQ(bounded.dequeue(), packet);
+
+    ASSERT_EQ(bounded.getPacketCount(), 0u);
+    ASSERT_FALSE(bounded.dequeue().assigned());
+    ASSERT_FALSE(bounded.peek().assigned());
+}
+
+TEST_F(BoundedConnectionTest, DropOldest)
+{
+    auto bounded = createBounded(2, QueueOverflowPolicy::DropOldest);
+    auto packets = createPackets();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(4);
+    for (const auto& packet : packets)
+        bounded.enqueue(packet);
+
+    ASSERT_EQ(bounded.getPacketCount(), 2u);
+    ASSERT_EQ(bounded.dequeue(), packets[2]);
+    ASSERT_EQ(bounded.dequeue(), packets[3]);
+
+    auto stats = bounded.asPtr<IConnectionStatistics>();
+    ASSERT_EQ(stats.getQueueCapacity(), 2u);
+    ASSERT_EQ(stats.getOverflowPolicy(), QueueOverflowPolicy::DropOldest);
+    ASSERT_EQ(stats.getDroppedPacketCount(), 2u);
+    ASSERT_EQ(stats.getHighWaterMark(), 2u);
+}
+
+TEST_F(BoundedConnectionTest, DropNewest)
+{
+    auto bounded = createBounded(2, QueueOverflowPolicy::DropNewest);
+    auto packets = createPackets();
+
+    // Dropped packets do not notify the input port
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(2);
+    for (const auto& packet : packets)
+        bounded.enqueue(packet);
+
+    ASSERT_EQ(bounded.dequeue(), packets[0]);
+    ASSERT_EQ(bounded.dequeue(), packets[1]);
+    ASSERT_EQ(bounded.asPtr<IConnectionStatistics>().getDroppedPacketCount(), 2u);
+}
+
+TEST_F(BoundedConnectionTest, BlockProducer)
+{
+    auto bounded = createBounded(1, QueueOverflowPolicy::BlockProducer);
+    auto packets = createPackets();
+
+    EXPECT_CALL(inputPort.mock(), getConnection(_))
+        .WillRepeatedly(Invoke([&bounded](IConnection** conn)
+        {
+            *conn = bounded.addRefAndReturn();
+            return OPENDAQ_SUCCESS;
+        }));
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(2);
+
+    bounded.enqueue(packets[0]);
+
+    std::thread producer([&bounded, &packets] { bounded.enqueue(packets[1]); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(bounded.dequeue(), packets[0]);
+
+    producer.join();
+    ASSERT_EQ(bounded.dequeue(), packets[1]);
+    ASSERT_EQ(bounded.asPtr<IConnectionStatistics>().getDroppedPacketCount(), 0u);
+}
+
+TEST_F(BoundedConnectionTest, BlockMultipleProducers)
+{
+    auto bounded = createBounded(2, QueueOverflowPolicy::BlockProducer);
+    constexpr SizeT producerCount = 4;
+    constexpr SizeT packetsPerProducer = 1000;
+
+    EXPECT_CALL(inputPort.mock(), getConnection(_))
+        .WillRepeatedly(Invoke([&bounded](IConnection** conn)
+        {
+            *conn = bounded.addRefAndReturn();
+            return OPENDAQ_SUCCESS;
+        }));
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(producerCount * packetsPerProducer);
+
+    std::vector<std::thread> producers;
+    for (SizeT i = 0; i < producerCount; ++i)
+        producers.emplace_back([&bounded]
+        {
+            for (SizeT j = 0; j < packetsPerProducer; ++j)
+                bounded.enqueue(createWithImplementation<IPacket, MockPacket>());
+        });
+
+    SizeT received = 0;
+    while (received < producerCount * packetsPerProducer)
+        if (bounded.dequeue().assigned())
+            ++received;
+
+    for (auto& producer : producers)
+        producer.join();
+
+    ASSERT_EQ(bounded.getPacketCount(), 0u);
+    ASSERT_EQ(bounded.asPtr<IConnectionStatistics>().getDroppedPacketCount(), 0u);
+}
+
+TEST_F(BoundedConnectionTest, BlockProducerDetached)
+{
+    auto bounded = createBounded(1, QueueOverflowPolicy::BlockProducer);
+    auto packets = createPackets();
+
+    // The input port no longer references the connection, so the producer must not block
+    EXPECT_CALL(inputPort.mock(), getConnection(_)).WillRepeatedly(DoAll(SetArgPointee<0>(nullptr), Return(OPENDAQ_SUCCESS)));
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(1);
+
+    bounded.enqueue(packets[0]);
+    bounded.enqueue(packets[1]);
+
+    ASSERT_EQ(bounded.getPacketCount(), 1u);
+    ASSERT_EQ(bounded.asPtr<IConnectionStatistics>().getDroppedPacketCount(), 1u);
+}
+
+TEST_F(BoundedConnectionTest, SampleAccounting)
+{
+    auto bounded = createBounded(3, QueueOverflowPolicy::DropOldest);
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(4);
+    bounded.enqueue(DataPacket(descriptor, 10));
+    bounded.enqueue(DataPacket(descriptor, 5));
+    bounded.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+
+    ASSERT_EQ(bounded.getAvailableSamples(), 15u);
+    ASSERT_EQ(bounded.getSamplesUntilNextDescriptor(), 15u);
+
+    // Evicts the first packet
+    bounded.enqueue(DataPacket(descriptor, 7));
+    ASSERT_EQ(bounded.getAvailableSamples(), 12u);
+    ASSERT_EQ(bounded.getSamplesUntilNextDescriptor(), 5u);
+
+    bounded.dequeue();
+    bounded.dequeue();
+    ASSERT_EQ(bounded.getAvailableSamples(), 7u);
+    ASSERT_EQ(bounded.getSamplesUntilNextDescriptor(), 7u);
+}
+
+TEST_F(BoundedConnectionTest, SamplesUntilDescriptorFromOtherThread)
+{
+    auto bounded = createBounded(4, QueueOverflowPolicy::DropOldest);
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    EXPECT_CALL(inputPort.mock(), notifyPacketEnqueued).Times(AnyNumber());
+
+    std::atomic<bool> running{true};
+    std::thread producer([&]
+    {
+        while (running)
+        {
+            bounded.enqueue(DataPacket(descriptor, 10));
+            bounded.enqueue(DataDescriptorChangedEventPacket(descriptor, nullptr));
+        }
+    });
+    std::thread consumer([&]
+    {
+        while (running)
+            bounded.dequeue();
+    });
+
+    // At most 4 packets of 10 samples are ever queued
+    std::size_t invalid = 0;
+    for (int i = 0; i < 100000; ++i)
+        if (bounded.getSamplesUntilNextDescriptor() > 40u)
+            ++invalid;
+
+    running = false;
+    producer.join();
+    consumer.join();
+
+    ASSERT_EQ(invalid, 0u);
+}
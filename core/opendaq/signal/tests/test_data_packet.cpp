@@ -5,7 +5,11 @@
 #include <opendaq/data_rule_factory.h>
 #include <opendaq/scaling_factory.h>
 #include <opendaq/dimension_factory.h>
+#include <opendaq/domain_view.h>
+#include <opendaq/external_allocator_factory.h>
+#include <opendaq/deleter_factory.h>
 #include <gtest/gtest.h>
+#include <thread>
 
 using DataPacketTest = testing::Test;
 
@@ -280,6 +284,52 @@ TEST_F(DataPacketTest, TestInt64LinearScaling)
     validateLinearScalingPacket<int64_t, double>(descriptor, 1012, 10020);
 }
 
+TEST_F(DataPacketTest, TestPolynomialScaling)
+{
+    const auto descriptor = setupDescriptor(
+        SampleType::Float64, ExplicitDataRule(), PolynomialScaling(List<INumber>(1.5, -2, 0.25), SampleType::Int16));
+
+    const DataPacketPtr packet = createExplicitPacket<int16_t, 100>(descriptor);
+    const auto scaledData = static_cast<double*>(packet.getData());
+    for (uint64_t i = 0; i < packet.getSampleCount(); ++i)
+        ASSERT_DOUBLE_EQ(scaledData[i], 1.5 - 2.0 * i + 0.25 * i * i);
+}
+
+TEST_F(DataPacketTest, TestLookupTableScaling)
+{
+    const auto descriptor = setupDescriptor(
+        SampleType::Float32,
+        ExplicitDataRule(),
+        LookupTableScaling(List<INumber>(10, 20, 40), List<INumber>(0, 100, 50), SampleType::UInt8, ScaledSampleType::Float32));
+
+    const DataPacketPtr packet = createExplicitPacket<uint8_t, 100>(descriptor);
+    const auto scaledData = static_cast<float*>(packet.getData());
+    ASSERT_FLOAT_EQ(scaledData[0], 0.0f);
+    ASSERT_FLOAT_EQ(scaledData[10], 0.0f);
+    ASSERT_FLOAT_EQ(scaledData[15], 50.0f);
+    ASSERT_FLOAT_EQ(scaledData[20], 100.0f);
+    ASSERT_FLOAT_EQ(scaledData[30], 75.0f);
+    ASSERT_FLOAT_EQ(scaledData[40], 50.0f);
+    ASSERT_FLOAT_EQ(scaledData[99], 50.0f);
+}
+
+TEST_F(DataPacketTest, TestUniformLookupTableScaling)
+{
+    const auto descriptor = setupDescriptor(
+        SampleType::Float64,
+        ExplicitDataRule(),
+        LookupTableScaling(List<INumber>(0, 25, 50, 75), List<INumber>(0, 10, 30, 60), SampleType::Int32));
+
+    const DataPacketPtr packet = createExplicitPacket<int32_t, 100>(descriptor);
+    const auto scaledData = static_cast<double*>(packet.getData());
+    ASSERT_DOUBLE_EQ(scaledData[0], 0.0);
+    ASSERT_DOUBLE_EQ(scaledData[5], 2.0);
+    ASSERT_DOUBLE_EQ(scaledData[25], 10.0);
+    ASSERT_DOUBLE_EQ(scaledData[60], 42.0);
+    ASSERT_DOUBLE_EQ(scaledData[75], 60.0);
+    ASSERT_DOUBLE_EQ(scaledData[99], 60.0);
+}
+
 TEST_F(DataPacketTest, TestConstantRule)
 {
     auto descriptor = setupDescriptor(SampleType::Int32, ConstantDataRule(111), nullptr);
@@ -400,4 +450,90 @@ TEST_F(DataPacketTest, PacketWithStructSampleType)
     const DataPacketPtr packet = DataPacket(canMsgDescriptor, 100, 0);
 }
 
+TEST_F(DataPacketTest, LinearDomainView)
+{
+    const auto descriptor = setupDescriptor(SampleType::Int64, LinearDataRule(10, 5), nullptr);
+    const DataPacketPtr packet = DataPacket(descriptor, 100, 1000);
+
+    const DomainView<Int> view(packet);
+    ASSERT_TRUE(view.isLinear());
+    ASSERT_EQ(view.getSampleCount(), 100u);
+    ASSERT_EQ(view.getDelta(), 10);
+    ASSERT_EQ(view.getFirstValue(), 1005);
+    ASSERT_EQ(view.getLastValue(), 1995);
+
+    std::vector<double> values(10);
+    ASSERT_EQ(view.copyTo(values.data(), 50, values.size()), values.data() + values.size());
+
+    const auto data = static_cast<Int*>(packet.getData());
+    for (SizeT i = 0; i < values.size(); ++i)
+    {
+        ASSERT_EQ(view[50 + i], data[50 + i]);
+        ASSERT_EQ(values[i], static_cast<double>(data[50 + i]));
+    }
+}
+
+TEST_F(DataPacketTest, ExplicitDomainView)
+{
+    const auto descriptor = setupDescriptor(SampleType::UInt64, ExplicitDataRule(), nullptr);
+    const DataPacketPtr packet = createExplicitPacket<uint64_t, 20>(descriptor);
+
+    const DomainView<uint64_t> view(packet);
+    ASSERT_FALSE(view.isLinear());
+    ASSERT_EQ(view.getFirstValue(), 0u);
+    ASSERT_EQ(view.getLastValue(), 19u);
+    ASSERT_EQ(view[7], 7u);
+
+    ASSERT_THROW(DomainView<uint32_t>{packet}, InvalidSampleTypeException);
+}
+
+TEST_F(DataPacketTest, ConcurrentGetDataMaterializesOnce)
+{
+    const auto descriptor = setupDescriptor(SampleType::Int32, LinearDataRule(2, 5), nullptr);
+
+    for (int i = 0; i < 50; ++i)
+    {
+        const DataPacketPtr packet = DataPacket(descriptor, 1000, 10);
+
+        std::vector<void*> results(4);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < results.size(); ++t)
+            threads.emplace_back([&packet, &results, t] { results[t] = packet.getData(); });
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto result : results)
+            ASSERT_EQ(result, results[0]);
+
+        const auto data = static_cast<int32_t*>(results[0]);
+        for (int32_t j = 0; j < 1000; ++j)
+            ASSERT_EQ(data[j], 10 + 5 + j * 2);
+    }
+}
+
+TEST_F(DataPacketTest, ScaledDataAllocator)
+{
+    const auto descriptor = setupDescriptor(
+        SampleType::Int16, ExplicitDataRule(), LinearScaling(2, 1, SampleType::Int16, ScaledSampleType::Float64));
+
+    double scaledBuffer[10];
+    bool freed = false;
+    auto scaledDataAllocator = ExternalAllocator(scaledBuffer, Deleter([&freed](void*) { freed = true; }));
+
+    {
+        const DataPacketPtr packet = DataPacketWithScaledDataAllocator(nullptr, descriptor, 10, nullptr, nullptr, scaledDataAllocator);
+        const auto raw = static_cast<int16_t*>(packet.getRawData());
+        for (int16_t i = 0; i < 10; ++i)
+            raw[i] = i;
+
+        ASSERT_EQ(packet.getData(), scaledBuffer);
+        ASSERT_EQ(packet.getData(), scaledBuffer);
+        for (int i = 0; i < 10; ++i)
+            ASSERT_EQ(scaledBuffer[i], i * 2.0 + 1.0);
+        ASSERT_FALSE(freed);
+    }
+
+    ASSERT_TRUE(freed);
+}
+
 END_NAMESPACE_OPENDAQ
@@ -8,10 +8,61 @@
 #include <opendaq/deserialize_component_ptr.h>
 #include <opendaq/context_factory.h>
 #include <opendaq/component_deserialize_context_factory.h>
+#include <opendaq/logger_factory.h>
+#include <opendaq/scheduler_factory.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
 using namespace daq;
 using namespace testing;
 
+class CountingNotificationsImpl : public ImplementationOf<IInputPortNotifications>
+{
+public:
+    explicit CountingNotificationsImpl(const std::atomic<SizeT>& notified)
+        : notified(notified)
+    {
+    }
+
+    std::atomic<SizeT> calls{0};
+    std::atomic<SizeT> notifiedAtLastCall{0};
+    std::atomic<bool> overlapped{false};
+
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override
+    {
+        *accept = True;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override
+    {
+        if (running.fetch_add(1) != 0)
+            overlapped = true;
+
+        notifiedAtLastCall = notified.load();
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+
+        running.fetch_sub(1);
+        return OPENDAQ_SUCCESS;
+    }
+
+private:
+    const std::atomic<SizeT>& notified;
+    std::atomic<int> running{0};
+};
+
 class InputPortTest : public Test
 {
 public:
@@ -105,6 +156,64 @@ TEST_F(InputPortTest, SwitchToSameThreadNotification)
     ASSERT_NO_THROW(inputPort.notifyPacketEnqueued());
 }
 
+TEST_F(InputPortTest, SchedulerNotificationsCoalesced)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger, 4), logger, nullptr, nullptr);
+    const auto port = InputPort(context, nullptr, "port");
+
+    std::atomic<SizeT> notified{0};
+    auto notificationsImpl = new CountingNotificationsImpl(notified);
+    InputPortNotificationsPtr listener;
+    checkErrorInfo(notificationsImpl->queryInterface(IInputPortNotifications::Id, reinterpret_cast<void**>(&listener)));
+
+    port.setListener(listener);
+    port.setNotificationMethod(PacketReadyNotification::Scheduler);
+
+    constexpr SizeT notificationsPerThread = 5000;
+    auto notify = [&port, &notified]
+    {
+        for (SizeT i = 0; i < notificationsPerThread; ++i)
+        {
+            ++notified;
+            port.notifyPacketEnqueued();
+        }
+    };
+
+    std::thread first(notify);
+    std::thread second(notify);
+    first.join();
+    second.join();
+    context.getScheduler().waitAll();
+
+    // The listener never runs concurrently, runs far less often than it was notified,
+    // and always runs at least once after the last notification.
+    ASSERT_FALSE(notificationsImpl->overlapped);
+    ASSERT_GE(notificationsImpl->calls, 1u);
+    ASSERT_LT(notificationsImpl->calls, 2 * notificationsPerThread);
+    ASSERT_EQ(notificationsImpl->notifiedAtLastCall, 2 * notificationsPerThread);
+}
+
+TEST_F(InputPortTest, QueueOptions)
+{
+    ASSERT_NO_THROW(inputPort.setQueueOptions(0, QueueOverflowPolicy::Unbounded));
+    ASSERT_NO_THROW(inputPort.setQueueOptions(8, QueueOverflowPolicy::DropNewest));
+    ASSERT_THROW(inputPort.setQueueOptions(8, QueueOverflowPolicy::Unbounded), InvalidParameterException);
+}
+
+TEST_F(InputPortTest, BlockProducerSameThreadRejected)
+{
+    inputPort.setNotificationMethod(PacketReadyNotification::SameThread);
+    ASSERT_THROW(inputPort.setQueueOptions(8, QueueOverflowPolicy::BlockProducer), InvalidStateException);
+
+    inputPort.setNotificationMethod(PacketReadyNotification::None);
+    ASSERT_NO_THROW(inputPort.setQueueOptions(8, QueueOverflowPolicy::BlockProducer));
+    ASSERT_THROW(inputPort.setNotificationMethod(PacketReadyNotification::SameThread), InvalidStateException);
+
+    // Without a scheduler, the scheduler notification falls back to the same thread
+    ASSERT_THROW(inputPort.setNotificationMethod(PacketReadyNotification::Scheduler), InvalidStateException);
+}
+
 TEST_F(InputPortTest, StandardProperties)
 {
     const auto name = "foo";
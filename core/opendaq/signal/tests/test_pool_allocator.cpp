@@ -0,0 +1,173 @@
+#include <opendaq/pool_allocator_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <thread>
+#include <vector>
+
+using PoolAllocatorTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+TEST_F(PoolAllocatorTest, TestFactory)
+{
+    AllocatorPtr allocator;
+    void* ptr = nullptr;
+
+    ASSERT_NO_THROW(allocator = PoolAllocator());
+
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 8));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 0));
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(allocator.free(nullptr));
+}
+
+TEST_F(PoolAllocatorTest, ReuseSameSize)
+{
+    const auto allocator = PoolAllocator();
+    const auto statistics = allocator.asPtr<IAllocatorStatistics>();
+
+    void* first = allocator.allocate(nullptr, 64, 8);
+    allocator.free(first);
+    ASSERT_EQ(statistics.getPooledBytes(), 64u);
+
+    void* second = allocator.allocate(nullptr, 64, 8);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(statistics.getPooledBytes(), 0u);
+
+    void* third = allocator.allocate(nullptr, 128, 8);
+    ASSERT_NE(third, second);
+
+    allocator.free(second);
+    allocator.free(third);
+
+    ASSERT_EQ(statistics.getHitCount(), 1u);
+    ASSERT_EQ(statistics.getMissCount(), 2u);
+    ASSERT_EQ(statistics.getPooledBytes(), 192u);
+}
+
+TEST_F(PoolAllocatorTest, ReuseSizeClass)
+{
+    const auto allocator = PoolAllocator();
+    const auto statistics = allocator.asPtr<IAllocatorStatistics>();
+
+    void* first = allocator.allocate(nullptr, 100, 8);
+    allocator.free(first);
+    ASSERT_EQ(statistics.getPooledBytes(), 128u);
+
+    void* second = allocator.allocate(nullptr, 120, 8);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(statistics.getHitCount(), 1u);
+
+    void* third = allocator.allocate(nullptr, 129, 8);
+    ASSERT_NE(third, second);
+    ASSERT_EQ(statistics.getMissCount(), 2u);
+
+    allocator.free(second);
+    allocator.free(third);
+    ASSERT_EQ(statistics.getPooledBytes(), 128u + 256u);
+}
+
+TEST_F(PoolAllocatorTest, MaxPooledBytes)
+{
+    const auto allocator = PoolAllocator(100);
+    const auto statistics = allocator.asPtr<IAllocatorStatistics>();
+
+    void* first = allocator.allocate(nullptr, 64, 8);
+    void* second = allocator.allocate(nullptr, 64, 8);
+    allocator.free(first);
+    allocator.free(second);
+
+    ASSERT_EQ(statistics.getPooledBytes(), 64u);
+}
+
+TEST_F(PoolAllocatorTest, Alignment)
+{
+    const auto allocator = PoolAllocator();
+    const auto statistics = allocator.asPtr<IAllocatorStatistics>();
+
+    void* ptr = allocator.allocate(nullptr, 96, 48);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 16, 0u);
+    allocator.free(ptr);
+    ASSERT_EQ(statistics.getPooledBytes(), 128u);
+
+    // blocks aligned stricter than the pool blocks bypass the pool
+    for (SizeT align : {32u, 64u, 256u, 4096u})
+    {
+        ptr = allocator.allocate(nullptr, 100, align);
+        ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % align, 0u);
+        allocator.free(ptr);
+    }
+
+    ASSERT_EQ(statistics.getPooledBytes(), 128u);
+    ASSERT_EQ(statistics.getMissCount(), 5u);
+}
+
+TEST_F(PoolAllocatorTest, OutOfMemory)
+{
+    const auto allocator = PoolAllocator();
+
+    ASSERT_THROW(allocator.allocate(nullptr, std::numeric_limits<SizeT>::max(), 8), NoMemoryException);
+    ASSERT_THROW(allocator.allocate(nullptr, std::numeric_limits<SizeT>::max() - 64, 64), NoMemoryException);
+}
+
+TEST_F(PoolAllocatorTest, DataPackets)
+{
+    const auto allocator = PoolAllocator();
+    const auto statistics = allocator.asPtr<IAllocatorStatistics>();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        auto packet = DataPacket(descriptor, 100, nullptr, allocator);
+        auto data = static_cast<double*>(packet.getRawData());
+        data[0] = 1.0;
+        data[99] = 2.0;
+    }
+
+    ASSERT_EQ(statistics.getMissCount(), 1u);
+    ASSERT_EQ(statistics.getHitCount(), 9u);
+    ASSERT_EQ(statistics.getPooledBytes(), 1024u);
+}
+
+TEST_F(PoolAllocatorTest, PacketObjectsReused)
+{
+    const auto statistics = PacketObjectPoolStatistics();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    const SizeT hitCount = statistics.getHitCount();
+    for (int i = 0; i < 10; ++i)
+        DataPacket(descriptor, 100);
+
+    ASSERT_GE(statistics.getHitCount() - hitCount, 9u);
+}
+
+TEST_F(PoolAllocatorTest, PacketObjectsReleasedOnOtherThread)
+{
+    const auto statistics = PacketObjectPoolStatistics();
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    constexpr size_t packetCount = 200;
+
+    std::vector<DataPacketPtr> packets;
+    for (size_t i = 0; i < packetCount; ++i)
+        packets.push_back(DataPacket(descriptor, 1));
+
+    std::thread consumer([&packets] { packets.clear(); });
+    consumer.join();
+
+    const SizeT hitCount = statistics.getHitCount();
+    std::thread producer([&descriptor]
+    {
+        std::vector<DataPacketPtr> newPackets;
+        for (size_t i = 0; i < packetCount; ++i)
+            newPackets.push_back(DataPacket(descriptor, 1));
+    });
+    producer.join();
+
+    ASSERT_GE(statistics.getHitCount() - hitCount, packetCount / 2);
+    ASSERT_GT(statistics.getPooledBytes(), 0u);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -0,0 +1,206 @@
+#include <opendaq/ring_allocator_factory.h>
+#include <opendaq/packet_factory.h>
+#include <opendaq/allocator_statistics_ptr.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using RingAllocatorTest = testing::Test;
+
+BEGIN_NAMESPACE_OPENDAQ
+
+TEST_F(RingAllocatorTest, TestFactory)
+{
+    AllocatorPtr allocator;
+    void* ptr = nullptr;
+
+    ASSERT_NO_THROW(allocator = RingAllocator(1024));
+
+    ASSERT_NO_THROW(ptr = allocator.allocate(nullptr, 32, 8));
+    ASSERT_NE(ptr, nullptr);
+    ASSERT_NO_THROW(allocator.free(ptr));
+    ASSERT_NO_THROW(allocator.free(nullptr));
+
+    ASSERT_THROW(RingAllocator(0), InvalidParameterException);
+}
+
+TEST_F(RingAllocatorTest, HugePages)
+{
+    const auto allocator = RingAllocator(4 * 1024 * 1024, 0, true);
+
+    auto data = static_cast<uint8_t*>(allocator.allocate(nullptr, 1024 * 1024, 8));
+    ASSERT_NE(data, nullptr);
+    data[0] = 1;
+    data[1024 * 1024 - 1] = 2;
+    allocator.free(data);
+}
+
+TEST_F(RingAllocatorTest, ConsecutiveSlices)
+{
+    const auto allocator = RingAllocator(1024);
+
+    auto first = static_cast<uint8_t*>(allocator.allocate(nullptr, 100, 8));
+    auto second = static_cast<uint8_t*>(allocator.allocate(nullptr, 100, 8));
+    ASSERT_GT(second, first);
+    ASSERT_GE(second - first, 100);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(first) % 64, 0u);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(second) % 64, 0u);
+
+    allocator.free(first);
+    allocator.free(second);
+}
+
+TEST_F(RingAllocatorTest, FullRing)
+{
+    const auto allocator = RingAllocator(1024);
+
+    void* first = allocator.allocate(nullptr, 400, 8);
+    void* second = allocator.allocate(nullptr, 400, 8);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    ASSERT_EQ(allocator.allocate(nullptr, 400, 8), nullptr);
+    ASSERT_EQ(allocator.allocate(nullptr, 2048, 8), nullptr);
+
+    allocator.free(first);
+    void* third = allocator.allocate(nullptr, 400, 8);
+    ASSERT_EQ(third, first);
+
+    allocator.free(second);
+    allocator.free(third);
+}
+
+TEST_F(RingAllocatorTest, ReleaseInAllocationOrder)
+{
+    const auto allocator = RingAllocator(1024);
+
+    void* first = allocator.allocate(nullptr, 400, 8);
+    void* second = allocator.allocate(nullptr, 400, 8);
+
+    // the slice is returned to the ring only after the older slice is released
+    allocator.free(second);
+    ASSERT_EQ(allocator.allocate(nullptr, 400, 8), nullptr);
+
+    allocator.free(first);
+    void* third = allocator.allocate(nullptr, 900, 8);
+    ASSERT_EQ(third, first);
+    allocator.free(third);
+}
+
+TEST_F(RingAllocatorTest, WrapAround)
+{
+    const auto allocator = RingAllocator(1024);
+
+    void* first = allocator.allocate(nullptr, 250, 8);
+    void* second = allocator.allocate(nullptr, 250, 8);
+    void* third = allocator.allocate(nullptr, 250, 8);
+    ASSERT_NE(third, nullptr);
+
+    allocator.free(first);
+    allocator.free(second);
+
+    // does not fit at the end of the buffer and wraps to its start
+    void* fourth = allocator.allocate(nullptr, 250, 8);
+    ASSERT_EQ(fourth, first);
+
+    allocator.free(third);
+    allocator.free(fourth);
+}
+
+TEST_F(RingAllocatorTest, WaitForRelease)
+{
+    const auto allocator = RingAllocator(1024, 5000);
+
+    void* first = allocator.allocate(nullptr, 900, 8);
+    ASSERT_NE(first, nullptr);
+
+    std::thread consumer([&allocator, first]
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        allocator.free(first);
+    });
+
+    void* second = allocator.allocate(nullptr, 900, 8);
+    consumer.join();
+
+    ASSERT_EQ(second, first);
+    allocator.free(second);
+}
+
+TEST_F(RingAllocatorTest, WaitTimeout)
+{
+    const auto allocator = RingAllocator(1024, 10);
+
+    void* first = allocator.allocate(nullptr, 900, 8);
+    ASSERT_EQ(allocator.allocate(nullptr, 900, 8), nullptr);
+    allocator.free(first);
+}
+
+TEST_F(RingAllocatorTest, PacketSlices)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    const auto allocator = RingAllocator(64 * 1024);
+
+    std::vector<DataPacketPtr> packets;
+    for (int i = 0; i < 50; ++i)
+        packets.push_back(DataPacket(descriptor, 100, nullptr, allocator));
+
+    for (size_t i = 1; i < packets.size(); ++i)
+        ASSERT_GT(packets[i].getRawData(), packets[i - 1].getRawData());
+
+    ASSERT_THROW(DataPacket(descriptor, 8192, nullptr, allocator), NoMemoryException);
+
+    void* firstData = packets[0].getRawData();
+    packets.clear();
+
+    const auto packet = DataPacket(descriptor, 8000, nullptr, allocator);
+    ASSERT_EQ(packet.getRawData(), firstData);
+}
+
+TEST_F(RingAllocatorTest, HeapFallback)
+{
+    const auto allocator = RingAllocator(1024, 0, false, true);
+    const auto statistics = allocator.asPtr<IAllocatorStatistics>();
+
+    auto held = static_cast<uint8_t*>(allocator.allocate(nullptr, 900, 8));
+    ASSERT_EQ(statistics.getPooledBytes(), 0u);
+
+    // the held slice keeps the ring full, so the next allocations are served from the heap
+    auto fallback = static_cast<uint8_t*>(allocator.allocate(nullptr, 900, 8));
+    auto oversized = static_cast<uint8_t*>(allocator.allocate(nullptr, 4096, 8));
+    ASSERT_NE(fallback, nullptr);
+    ASSERT_NE(oversized, nullptr);
+    ASSERT_TRUE(fallback + 900 <= held || fallback >= held + 1024);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(fallback) % 64, 0u);
+
+    ASSERT_EQ(statistics.getHitCount(), 1u);
+    ASSERT_EQ(statistics.getMissCount(), 2u);
+
+    allocator.free(fallback);
+    allocator.free(oversized);
+    allocator.free(held);
+    ASSERT_EQ(statistics.getPooledBytes(), 1024u);
+
+    ASSERT_EQ(allocator.allocate(nullptr, 900, 8), held);
+    ASSERT_EQ(statistics.getHitCount(), 2u);
+    allocator.free(held);
+}
+
+TEST_F(RingAllocatorTest, Alignment)
+{
+    const auto allocator = RingAllocator(1024);
+
+    // element sizes that are not a power of two require the alignment of their largest power-of-two divisor
+    void* ptr = allocator.allocate(nullptr, 120, 24);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 8, 0u);
+    allocator.free(ptr);
+
+    ASSERT_THROW(allocator.allocate(nullptr, 128, 128), InvalidParameterException);
+
+    const auto fallbackAllocator = RingAllocator(1024, 0, false, true);
+    ptr = fallbackAllocator.allocate(nullptr, 256, 256);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(ptr) % 256, 0u);
+    fallbackAllocator.free(ptr);
+}
+
+END_NAMESPACE_OPENDAQ
@@ -56,6 +56,56 @@ TEST_F(ScalingTest, LinearScalingInvalidParameters)
     ASSERT_NO_THROW(ruleBuilder.build());
 }
 
+TEST_F(ScalingTest, PolynomialScalingSetGet)
+{
+    const auto rule = PolynomialScaling(List<INumber>(1, 2.5, 3));
+
+    ASSERT_EQ(rule.getType(), ScalingType::Polynomial);
+    ASSERT_EQ(rule.getParameters().get("coefficients"), List<INumber>(1, 2.5, 3));
+}
+
+TEST_F(ScalingTest, PolynomialScalingInvalidParameters)
+{
+    ASSERT_THROW(PolynomialScaling(List<INumber>()), InvalidParametersException);
+    ASSERT_THROW(PolynomialScaling(List<INumber>(1, 2, 3, 4, 5, 6, 7)), InvalidParametersException);
+    ASSERT_THROW(Scaling(SampleType::Float64,
+                         ScaledSampleType::Float64,
+                         ScalingType::Polynomial,
+                         Dict<IString, IBaseObject>({{"coefficients", List<IBaseObject>(1, "wrong")}})),
+                 InvalidParametersException);
+    ASSERT_NO_THROW(PolynomialScaling(List<INumber>(1, 2, 3, 4, 5, 6)));
+}
+
+TEST_F(ScalingTest, LookupTableScalingSetGet)
+{
+    const auto rule = LookupTableScaling(List<INumber>(0, 10), List<INumber>(5, 15));
+
+    ASSERT_EQ(rule.getType(), ScalingType::LookupTable);
+    ASSERT_EQ(rule.getParameters().get("input"), List<INumber>(0, 10));
+    ASSERT_EQ(rule.getParameters().get("output"), List<INumber>(5, 15));
+}
+
+TEST_F(ScalingTest, LookupTableScalingInvalidParameters)
+{
+    ASSERT_THROW(LookupTableScaling(List<INumber>(0), List<INumber>(1)), InvalidParametersException);
+    ASSERT_THROW(LookupTableScaling(List<INumber>(0, 1, 2), List<INumber>(1, 2)), InvalidParametersException);
+    ASSERT_THROW(LookupTableScaling(List<INumber>(0, 2, 1), List<INumber>(1, 2, 3)), InvalidParametersException);
+    ASSERT_THROW(LookupTableScaling(List<INumber>(0, 1, 1), List<INumber>(1, 2, 3)), InvalidParametersException);
+    ASSERT_NO_THROW(LookupTableScaling(List<INumber>(-1, 0.5, 1), List<INumber>(1, 2, 3)));
+}
+
+TEST_F(ScalingTest, PolynomialScalingSerializeDeserialize)
+{
+    const auto scaling = PolynomialScaling(List<INumber>(1, -0.5, 0.125), SampleType::Int32, ScaledSampleType::Float32);
+    auto serializer = JsonSerializer(False);
+    scaling.serialize(serializer);
+
+    auto deserializer = JsonDeserializer();
+    auto scaling1 = deserializer.deserialize(serializer.getOutput().toStdString()).asPtr<IScaling>();
+
+    ASSERT_EQ(scaling1, scaling);
+}
+
 TEST_F(ScalingTest, InvalidInputDataType)
 {
     ASSERT_THROW(LinearScaling(10, 10, SampleType::ComplexFloat32), InvalidSampleTypeException);
@@ -5,13 +5,20 @@
 #include <opendaq/context_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/deserialize_component_ptr.h>
+#include <opendaq/event_packet_ids.h>
+#include <opendaq/event_packet_ptr.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/removable_ptr.h>
 #include <opendaq/signal_events.h>
 #include <opendaq/signal_exceptions.h>
 #include <opendaq/signal_factory.h>
 #include <opendaq/signal_private_ptr.h>
+#include <opendaq/signal_statistics_ptr.h>
 #include <opendaq/tags_factory.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 using SignalTest = testing::Test;
 
@@ -20,7 +27,8 @@ BEGIN_NAMESPACE_OPENDAQ
 class ConnectionMockImpl : public ImplementationOf<IConnection>
 {
 public:
-    bool packetEnqueued{false};
+    std::atomic<bool> packetEnqueued{false};
+    SizeT packetsEnqueued{0};
 
     ErrCode INTERFACE_FUNC enqueue(IPacket* packet) override
     {
@@ -74,6 +82,31 @@ public:
         *remote = False;
         return OPENDAQ_SUCCESS;
     }
+
+    ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) override
+    {
+        packetsEnqueued += ListPtr<IPacket>::Borrow(packets).getCount();
+        return OPENDAQ_SUCCESS;
+    }
+};
+
+class RecordingConnectionMockImpl : public ConnectionMockImpl
+{
+public:
+    std::mutex sync;
+    std::vector<PacketPtr> packets;
+
+    ErrCode INTERFACE_FUNC enqueue(IPacket* packet) override
+    {
+        std::scoped_lock lock(sync);
+        packets.emplace_back(packet);
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC enqueueOnThisThread(IPacket* packet) override
+    {
+        return enqueue(packet);
+    }
 };
 
 class PacketMockImpl : public ImplementationOf<IPacket>
@@ -344,6 +377,99 @@ TEST_F(SignalTest, SendPacket)
     ASSERT_TRUE(connImpl->packetEnqueued);
 }
 
+TEST_F(SignalTest, SendPackets)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+
+    auto connImpl = new ConnectionMockImpl();
+    ConnectionPtr conn;
+    checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+
+    signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+
+    signal.sendPackets(List<IPacket>(PacketMock(), PacketMock()));
+
+    ASSERT_EQ(connImpl->packetsEnqueued, 2u);
+}
+
+TEST_F(SignalTest, SentStatistics)
+{
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    signal.setDescriptor(descriptor);
+
+    const auto stats = signal.asPtr<ISignalStatistics>();
+    const SizeT initialPackets = stats.getSentPacketCount();
+
+    signal.sendPacket(DataPacket(descriptor, 10));
+    signal.sendPackets(List<IPacket>(DataPacket(descriptor, 5), DataPacket(descriptor, 5)));
+
+    signal.setActive(False);
+    signal.sendPacket(DataPacket(descriptor, 10));
+
+    ASSERT_EQ(stats.getSentPacketCount() - initialPackets, 3u);
+    ASSERT_EQ(stats.getSentSampleCount(), 20u);
+    ASSERT_EQ(stats.getSentByteCount(), 20u * sizeof(double));
+}
+
+TEST_F(SignalTest, SendPacketInactive)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+
+    auto connImpl = new ConnectionMockImpl();
+    ConnectionPtr conn;
+    checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+
+    signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+    connImpl->packetEnqueued = false;
+
+    signal.setActive(False);
+    ASSERT_EQ(signal->sendPacket(PacketMock()), OPENDAQ_IGNORED);
+    ASSERT_FALSE(connImpl->packetEnqueued);
+
+    signal.setActive(True);
+    ASSERT_EQ(signal->sendPacket(PacketMock()), OPENDAQ_SUCCESS);
+    ASSERT_TRUE(connImpl->packetEnqueued);
+}
+
+TEST_F(SignalTest, SendPacketWhileConnecting)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    const auto packet = PacketMock();
+
+    std::atomic<bool> sending{true};
+    std::thread sender([&signal, &packet, &sending]
+    {
+        while (sending)
+            signal.sendPacket(packet);
+    });
+
+    auto connImpl = new ConnectionMockImpl();
+    ConnectionPtr conn;
+    checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+
+    const auto signalEvents = signal.asPtr<ISignalEvents>();
+    for (int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(signalEvents->listenerConnected(conn), OPENDAQ_SUCCESS);
+        EXPECT_EQ(signal.getConnections().getCount(), 1u);
+        EXPECT_EQ(signalEvents->listenerDisconnected(conn), OPENDAQ_SUCCESS);
+        EXPECT_EQ(signal.getConnections().getCount(), 0u);
+
+        // no sender may still hold the connection once the disconnect returns
+        connImpl->packetEnqueued = false;
+        std::this_thread::yield();
+        EXPECT_FALSE(connImpl->packetEnqueued);
+    }
+
+    sending = false;
+    sender.join();
+
+    connImpl->packetEnqueued = false;
+    signal.sendPacket(packet);
+    ASSERT_FALSE(connImpl->packetEnqueued);
+}
+
 TEST_F(SignalTest, SetDescriptorWithConnection)
 {
     const auto signal = Signal(NullContext(), nullptr, "sig");
@@ -360,6 +486,102 @@ TEST_F(SignalTest, SetDescriptorWithConnection)
     ASSERT_TRUE(connImpl->packetEnqueued);
 }
 
+TEST_F(SignalTest, SetDescriptorOrderedWithDataOnSameThread)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+
+    std::vector<RecordingConnectionMockImpl*> connImpls;
+    for (int i = 0; i < 2; ++i)
+    {
+        auto connImpl = new RecordingConnectionMockImpl();
+        ConnectionPtr conn;
+        checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+        signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+        connImpls.push_back(connImpl);
+    }
+
+    const auto before = DataPacket(descriptor, 1);
+    const auto after = DataPacket(descriptor, 1);
+    signal.sendPacket(before);
+    signal.setDescriptor(descriptor);
+    signal.sendPacket(after);
+
+    for (const auto connImpl : connImpls)
+    {
+        // the first packet is the descriptor sent when the listener connected
+        ASSERT_EQ(connImpl->packets.size(), 4u);
+        ASSERT_EQ(connImpl->packets[1], before);
+        ASSERT_EQ(connImpl->packets[2].getType(), PacketType::Event);
+        ASSERT_EQ(connImpl->packets[2].asPtr<IEventPacket>().getEventId(), event_packet_id::DATA_DESCRIPTOR_CHANGED);
+        ASSERT_EQ(connImpl->packets[3], after);
+    }
+}
+
+// Data and descriptor changes sent from different threads are not ordered with respect to each other,
+// but every connection must receive all of them in the same order, with the data packets in the order they were sent.
+TEST_F(SignalTest, SetDescriptorConcurrentWithData)
+{
+    const auto signal = Signal(NullContext(), nullptr, "sig");
+    const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Float64).build();
+    constexpr SizeT packetCount = 2000;
+    constexpr SizeT descriptorCount = 200;
+
+    std::vector<RecordingConnectionMockImpl*> connImpls;
+    for (int i = 0; i < 2; ++i)
+    {
+        auto connImpl = new RecordingConnectionMockImpl();
+        ConnectionPtr conn;
+        checkErrorInfo(connImpl->queryInterface(IConnection::Id, reinterpret_cast<void**>(&conn)));
+        signal.asPtr<ISignalEvents>()->listenerConnected(conn);
+        connImpls.push_back(connImpl);
+    }
+
+    std::vector<DataPacketPtr> dataPackets;
+    for (SizeT i = 0; i < packetCount; ++i)
+        dataPackets.push_back(DataPacket(descriptor, 1));
+
+    std::thread sender([&signal, &dataPackets]
+    {
+        for (const auto& packet : dataPackets)
+            signal.sendPacket(packet);
+    });
+
+    for (SizeT i = 0; i < descriptorCount; ++i)
+        signal.setDescriptor(descriptor);
+
+    sender.join();
+
+    for (const auto connImpl : connImpls)
+    {
+        // the first packet is the descriptor sent when the listener connected
+        ASSERT_EQ(connImpl->packets.size(), 1 + packetCount + descriptorCount);
+
+        SizeT dataIndex = 0;
+        SizeT events = 0;
+        for (const auto& packet : connImpl->packets)
+        {
+            if (packet.getType() == PacketType::Event)
+                ++events;
+            else
+                ASSERT_EQ(packet, dataPackets[dataIndex++]);
+        }
+
+        ASSERT_EQ(dataIndex, packetCount);
+        ASSERT_EQ(events, 1 + descriptorCount);
+    }
+
+    // events are sent exclusively, so they land at the same position relative to the data on every connection
+    for (SizeT i = 0; i < connImpls[0]->packets.size(); ++i)
+    {
+        const auto& first = connImpls[0]->packets[i];
+        const auto& second = connImpls[1]->packets[i];
+        ASSERT_EQ(first.getType(), second.getType());
+        if (first.getType() == PacketType::Data)
+            ASSERT_EQ(first, second);
+    }
+}
+
 TEST_F(SignalTest, SetDomainDescriptorWithConnection)
 {
     const auto signal = Signal(NullContext(), nullptr, "sig");
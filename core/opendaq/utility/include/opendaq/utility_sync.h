@@ -17,6 +17,8 @@
 #pragma once
 
 #include <coretypes/common.h>
+#include <atomic>
+#include <thread>
 
 BEGIN_NAMESPACE_OPENDAQ
 
@@ -71,4 +73,24 @@ private:
     mutex* mt;
 };
 
+// Guards short critical sections, such as swapping a pointer, that are entered far more often than they
+// contend. Waiting threads yield instead of being suspended.
+class SpinLock
+{
+public:
+    void lock()
+    {
+        while (flag.test_and_set(std::memory_order_acquire))
+            std::this_thread::yield();
+    }
+
+    void unlock()
+    {
+        flag.clear(std::memory_order_release);
+    }
+
+private:
+    std::atomic_flag flag = ATOMIC_FLAG_INIT;
+};
+
 END_NAMESPACE_OPENDAQ
@@ -452,6 +452,12 @@ void AppSignal::printScaling(const ScalingPtr& scaling, std::streamsize indent,
         case ScalingType::Linear:
             std::cout << std::setw((indentLevel + 1) * indent) << "" << "Type : Linear," << std::endl;
             break;
+        case ScalingType::Polynomial:
+            std::cout << std::setw((indentLevel + 1) * indent) << "" << "Type : Polynomial," << std::endl;
+            break;
+        case ScalingType::LookupTable:
+            std::cout << std::setw((indentLevel + 1) * indent) << "" << "Type : LookupTable," << std::endl;
+            break;
     }
 
     std::cout << std::setw(indent * (indentLevel + 1)) << ""
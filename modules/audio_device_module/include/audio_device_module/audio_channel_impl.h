@@ -23,6 +23,7 @@
 #include <random>
 #include <miniaudio/miniaudio.h>
 #include <opendaq/data_packet_ptr.h>
+#include <opendaq/allocator_ptr.h>
 #include <mutex>
 
 BEGIN_NAMESPACE_AUDIO_DEVICE_MODULE
@@ -43,7 +44,10 @@ public:
     void addData(const DataPacketPtr& domainPacket, const void* data, size_t sampleCount) override;
 
 private:
+    static constexpr size_t PacketRingSeconds = 10;
+
     SignalConfigPtr outputSignal;
+    AllocatorPtr packetAllocator;
 };
 
 END_NAMESPACE_AUDIO_DEVICE_MODULE
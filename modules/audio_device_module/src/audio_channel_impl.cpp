@@ -1,6 +1,7 @@
 #include <audio_device_module/audio_channel_impl.h>
 #include <opendaq/signal_factory.h>
 #include <opendaq/packet_factory.h>
+#include <opendaq/ring_allocator_factory.h>
 #include <opendaq/range_factory.h>
 
 BEGIN_NAMESPACE_AUDIO_DEVICE_MODULE
@@ -23,11 +24,16 @@ void AudioChannelImpl::configure(const ma_device& device, const SignalPtr& timeS
 
     outputSignal.setDomainSignal(timeSignal);
     outputSignal.setDescriptor(dataDescriptor);
+
+    // Packets are slices of a ring sized for the samples that readers and streaming typically keep queued.
+    // A packet held longer keeps the ring from reclaiming newer slices, so the packets that do not fit are
+    // allocated on the heap instead of failing or blocking the realtime callback.
+    packetAllocator = RingAllocator(PacketRingSeconds * device.sampleRate * sizeof(float), 0, false, true);
 }
 
 void AudioChannelImpl::addData(const DataPacketPtr& domainPacket, const void* data, size_t sampleCount)
 {
-    auto dataPacket = DataPacketWithDomain(domainPacket, outputSignal.getDescriptor(), sampleCount);
+    auto dataPacket = DataPacketWithDomain(domainPacket, outputSignal.getDescriptor(), sampleCount, nullptr, packetAllocator);
 
     auto packetData = dataPacket.getRawData();
     std::memcpy(packetData, data, sampleCount * sizeof(float));
@@ -11,6 +11,7 @@
 #include <regex>
 
 #include <config_protocol/config_protocol_client.h>
+#include <packet_streaming/packet_streaming.h>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_CLIENT_MODULE
 
@@ -159,6 +160,13 @@ void NativeStreamingClientModule::populateConfigFromContext(PropertyObjectPtr co
         if (value.getCoreType() == CoreType::ctInt)
             transportLayerConfig.setPropertyValue("ReconnectionPeriod", value);
     }
+
+    if (options.hasKey("PacketStreamingCompression") && transportLayerConfig.hasProperty("PacketStreamingCompression"))
+    {
+        auto value = options.get("PacketStreamingCompression");
+        if (value.getCoreType() == CoreType::ctBool)
+            transportLayerConfig.setPropertyValue("PacketStreamingCompression", value);
+    }
 }
 
 DevicePtr NativeStreamingClientModule::onCreateDevice(const StringPtr& connectionString,
@@ -213,6 +221,10 @@ PropertyObjectPtr NativeStreamingClientModule::createTransportLayerDefaultConfig
     transportLayerConfig.addProperty(daq::IntProperty("ConnectionTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("StreamingInitTimeout", 1000));
     transportLayerConfig.addProperty(daq::IntProperty("ReconnectionPeriod", 1000));
+    transportLayerConfig.addProperty(daq::IntProperty("PacketStreamingVersion", PACKET_STREAMING_LATEST_VERSION));
+    transportLayerConfig.addProperty(daq::BoolProperty("PacketStreamingCompression", daq::False));
+    // overrides PacketStreamingCompression for individual signals, keyed by the signal IDs announced by the server
+    transportLayerConfig.addProperty(daq::DictProperty("PacketStreamingSignalCompression", daq::Dict<daq::IString, daq::IBoolean>()));
 
     return transportLayerConfig;
 }
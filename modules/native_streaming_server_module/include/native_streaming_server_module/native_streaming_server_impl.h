@@ -22,6 +22,9 @@
 #include <opendaq/server_impl.h>
 #include <coretypes/intfs.h>
 
+#include <atomic>
+#include <condition_variable>
+
 #include <native_streaming_protocol/native_streaming_server_handler.h>
 
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_SERVER_MODULE
@@ -40,12 +43,32 @@ protected:
 
     std::shared_ptr<opendaq_native_streaming_protocol::NativeStreamingServerHandler> serverHandler;
 
+    struct SignalReader
+    {
+        SignalPtr signal;
+        PacketReaderPtr reader;
+        std::shared_ptr<std::atomic<bool>> pending;
+    };
+
+    // Signals whose readers were notified of new packets since the read thread last drained them. Shared with the
+    // reader callbacks, which can still run on a producer thread while the server is being torn down.
+    struct ReadQueue
+    {
+        std::mutex sync;
+        std::condition_variable condition;
+        std::vector<SignalPtr> pendingSignals;
+        bool readThreadActive{false};
+    };
+
     void startReading();
     void stopReading();
     void startReadThread();
-    void createReaders();
     void addReader(SignalPtr signalToRead);
     void removeReader(SignalPtr signalToRead);
+    static void markPending(const std::weak_ptr<ReadQueue>& queueRef,
+                            const SignalPtr& signal,
+                            const std::shared_ptr<std::atomic<bool>>& pending);
+    void sendPendingPackets(const SignalPtr& signal);
 
     void startAsyncOperations();
     void stopAsyncOperations();
@@ -55,9 +78,8 @@ protected:
     void coreEventCallback(ComponentPtr& sender, CoreEventArgsPtr& eventArgs);
 
     std::thread readThread;
-    bool readThreadActive;
-    std::chrono::milliseconds readThreadSleepTime;
-    std::vector<std::pair<SignalPtr, PacketReaderPtr>> signalReaders;
+    std::vector<SignalReader> signalReaders;
+    std::shared_ptr<ReadQueue> readQueue;
 
     std::shared_ptr<boost::asio::io_context> ioContextPtr;
     boost::asio::executor_work_guard<boost::asio::io_context::executor_type> workGuard;
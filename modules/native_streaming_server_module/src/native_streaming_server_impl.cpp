@@ -20,8 +20,7 @@ using namespace opendaq_native_streaming_protocol;
 
 NativeStreamingServerImpl::NativeStreamingServerImpl(DevicePtr rootDevice, PropertyObjectPtr config, const ContextPtr& context)
     : Server(config, rootDevice, context, nullptr)
-    , readThreadActive(false)
-    , readThreadSleepTime(std::chrono::milliseconds(20))
+    , readQueue(std::make_shared<ReadQueue>())
     , ioContextPtr(std::make_shared<boost::asio::io_context>())
     , workGuard(ioContextPtr->get_executor())
     , logger(context.getLogger())
@@ -204,7 +203,10 @@ void NativeStreamingServerImpl::onStopServer()
 
 void NativeStreamingServerImpl::startReading()
 {
-    readThreadActive = true;
+    {
+        std::scoped_lock lock(readQueue->sync);
+        readQueue->readThreadActive = true;
+    }
     this->readThread = std::thread([this]()
     {
         this->startReadThread();
@@ -214,45 +216,84 @@ void NativeStreamingServerImpl::startReading()
 
 void NativeStreamingServerImpl::stopReading()
 {
-    readThreadActive = false;
+    {
+        std::scoped_lock lock(readQueue->sync);
+        readQueue->readThreadActive = false;
+    }
+    readQueue->condition.notify_one();
+
     if (readThread.joinable())
     {
         readThread.join();
         LOG_I("Reading thread joined");
     }
 
+    std::scoped_lock lock(readersSync);
     signalReaders.clear();
 }
 
 void NativeStreamingServerImpl::startReadThread()
 {
-    while (readThreadActive)
+    std::vector<SignalPtr> signalsToSend;
+
+    while (true)
     {
         {
-            std::scoped_lock lock(readersSync);
-            for (const auto& [signal, reader] : signalReaders)
-            {
-                PacketPtr packet = reader.read();
-                while (packet.assigned())
-                {
-                    serverHandler->sendPacket(signal, packet);
-                    packet = reader.read();
-                }
-            }
+            std::unique_lock lock(readQueue->sync);
+            readQueue->condition.wait(lock, [this] { return !readQueue->readThreadActive || !readQueue->pendingSignals.empty(); });
+            if (!readQueue->readThreadActive)
+                break;
+
+            signalsToSend.swap(readQueue->pendingSignals);
         }
 
-        std::this_thread::sleep_for(readThreadSleepTime);
+        for (const auto& signal : signalsToSend)
+            sendPendingPackets(signal);
+
+        signalsToSend.clear();
     }
 }
 
-void NativeStreamingServerImpl::createReaders()
+void NativeStreamingServerImpl::markPending(const std::weak_ptr<ReadQueue>& queueRef,
+                                            const SignalPtr& signal,
+                                            const std::shared_ptr<std::atomic<bool>>& pending)
 {
-    signalReaders.clear();
-    auto signals = rootDevice.getSignals(search::Recursive(search::Any()));
+    // Called on the thread that sent the packet; only the first notification after a drain wakes the read thread
+    if (pending->exchange(true))
+        return;
+
+    const auto queue = queueRef.lock();
+    if (!queue)
+        return;
 
-    for (const auto& signal : signals)
     {
-        addReader(signal);
+        std::scoped_lock lock(queue->sync);
+        queue->pendingSignals.push_back(signal);
+    }
+    queue->condition.notify_one();
+}
+
+void NativeStreamingServerImpl::sendPendingPackets(const SignalPtr& signal)
+{
+    std::scoped_lock lock(readersSync);
+
+    auto it = std::find_if(signalReaders.begin(),
+                           signalReaders.end(),
+                           [&signal](const SignalReader& element)
+                           {
+                               return element.signal == signal;
+                           });
+    if (it == signalReaders.end())
+        return;
+
+    // Cleared before draining, so packets arriving during the drain schedule the signal again
+    it->pending->store(false);
+
+    PacketPtr packet = it->reader.read();
+    while (packet.assigned())
+    {
+        serverHandler->sendPacket(signal, packet);
+        packet = it->reader.read();
     }
 }
 
@@ -260,29 +301,39 @@ void NativeStreamingServerImpl::addReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::pair<SignalPtr, PacketReaderPtr>& element)
+                           [&signalToRead](const SignalReader& element)
                            {
-                               return element.first == signalToRead;
+                               return element.signal == signalToRead;
                            });
     if (it != signalReaders.end())
         return;
 
     LOG_I("Add reader for signal {}", signalToRead.getGlobalId());
     auto reader = PacketReader(signalToRead);
-    signalReaders.push_back(std::pair<SignalPtr, PacketReaderPtr>({signalToRead, reader}));
+    auto pending = std::make_shared<std::atomic<bool>>(false);
+    reader.setOnDataAvailable([queueRef = std::weak_ptr<ReadQueue>(readQueue), signal = signalToRead, pending]
+                              {
+                                  markPending(queueRef, signal, pending);
+                              });
+    signalReaders.push_back({signalToRead, reader, pending});
+
+    // The descriptor event queued when the reader connected arrived before the callback was set
+    markPending(readQueue, signalToRead, pending);
 }
 
 void NativeStreamingServerImpl::removeReader(SignalPtr signalToRead)
 {
     auto it = std::find_if(signalReaders.begin(),
                            signalReaders.end(),
-                           [&signalToRead](const std::pair<SignalPtr, PacketReaderPtr>& element)
+                           [&signalToRead](const SignalReader& element)
                            {
-                               return element.first == signalToRead;
+                               return element.signal == signalToRead;
                            });
     if (it == signalReaders.end())
         return;
 
+    it->reader.setOnDataAvailable(nullptr);
+
     LOG_I("Remove reader for signal {}", signalToRead.getGlobalId());
     signalReaders.erase(it);
 }
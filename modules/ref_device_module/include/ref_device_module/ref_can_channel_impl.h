@@ -52,6 +52,7 @@ public:
     // IRefChannel
     void collectSamples(std::chrono::microseconds curTime) override;
     void globalSampleRateChanged(double globalSampleRate) override;
+    void loadGeneratorChanged(const RefLoadGeneratorSettings& settings) override;
 
     static std::string getEpoch();
     static RatioPtr getResolution();
@@ -16,19 +16,34 @@
 
 #pragma once
 #include <ref_device_module/common.h>
+#include <ref_device_module/waveform_kernels.h>
 #include <opendaq/channel_impl.h>
 #include <opendaq/signal_config_ptr.h>
+#include <opendaq/allocator_ptr.h>
+#include <opendaq/packet_ptr.h>
+#include <opendaq/sample_type.h>
+#include <coretypes/listobject_factory.h>
 #include <optional>
 #include <random>
+#include <vector>
 
 BEGIN_NAMESPACE_REF_DEVICE_MODULE
 
 enum class WaveformType { Sine, Rect, None, Counter };
 
+// In load generator mode channels replay a precomputed waveform table in packets of a fixed size
+struct RefLoadGeneratorSettings
+{
+    bool enabled;
+    SampleType sampleType;
+    uint64_t packetSize;
+};
+
 DECLARE_OPENDAQ_INTERFACE(IRefChannel, IBaseObject)
 {
     virtual void collectSamples(std::chrono::microseconds curTime) = 0;
     virtual void globalSampleRateChanged(double globalSampleRate) = 0;
+    virtual void loadGeneratorChanged(const RefLoadGeneratorSettings& settings) = 0;
 };
 
 struct RefChannelInit
@@ -37,6 +52,7 @@ struct RefChannelInit
     double globalSampleRate;
     std::chrono::microseconds startTime;
     std::chrono::microseconds microSecondsFromEpochToStartTime;
+    RefLoadGeneratorSettings loadGenerator;
 };
 
 class RefChannelImpl final : public ChannelImpl<IRefChannel>
@@ -47,6 +63,7 @@ public:
     // IRefChannel
     void collectSamples(std::chrono::microseconds curTime) override;
     void globalSampleRateChanged(double newGlobalSampleRate) override;
+    void loadGeneratorChanged(const RefLoadGeneratorSettings& settings) override;
     static std::string getEpoch();
     static RatioPtr getResolution();
 protected:
@@ -69,13 +86,22 @@ private:
     std::chrono::microseconds microSecondsFromEpochToStartTime;
     std::chrono::microseconds lastCollectTime;
     uint64_t samplesGenerated;
-    std::default_random_engine re;
-    std::normal_distribution<double> dist;
+    waveform::NoiseGenerator noise;
     SignalConfigPtr valueSignal;
     SignalConfigPtr timeSignal;
+    // Packets generated within one collect call, sent as a single batch per signal
+    ListPtr<IPacket> valuePackets;
+    ListPtr<IPacket> domainPackets;
+    AllocatorPtr packetAllocator;
     bool needsSignalTypeChanged;
     bool fixedPacketSize;
     uint64_t packetSize;
+    RefLoadGeneratorSettings loadGenerator;
+    // Raw samples of `LoadTableSamples` values in the load generator sample type; holds whole waveform periods
+    std::vector<uint8_t> loadTable;
+    double loadScale;
+
+    static constexpr size_t LoadTableSamples = 4096;
 
     void initProperties();
     void packetSizeChangedInternal();
@@ -89,6 +115,10 @@ private:
     uint64_t getSamplesSinceStart(std::chrono::microseconds time) const;
     void createSignals();
     void generateSamples(int64_t curTime, uint64_t samplesGenerated, uint64_t newSamples);
+    void generateChunk(double* out, size_t count, uint64_t firstSample);
+    void buildLoadTable();
+    void copyLoadTable(void* out, uint64_t firstSample, uint64_t sampleCount) const;
+    void sendGeneratedPackets();
     [[nodiscard]] Int getDeltaT(const double sr) const;
     void buildSignalDescriptors();
     [[nodiscard]] double coerceSampleRate(const double wantedSampleRate) const;
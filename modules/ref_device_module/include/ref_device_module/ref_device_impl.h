@@ -16,10 +16,13 @@
 
 #pragma once
 #include <ref_device_module/common.h>
+#include <ref_device_module/ref_channel_impl.h>
 #include <opendaq/channel_ptr.h>
 #include <opendaq/device_impl.h>
 #include <opendaq/logger_ptr.h>
 #include <opendaq/logger_component_ptr.h>
+#include <opendaq/scheduler_ptr.h>
+#include <opendaq/task_ptr.h>
 
 #include <thread>
 #include <condition_variable>
@@ -50,7 +53,14 @@ private:
     void initIoFolder();
     void initSyncComponent();
     void initProperties();
+    void initStatuses();
+    void initLoadGeneratorSignals();
+    void updateLoadGenerator();
+    void sendLoadGeneratorLag(std::chrono::microseconds curTime);
     void acqLoop();
+    void collectSamples(std::chrono::microseconds curTime);
+    void buildAcqGraph();
+    void updateAcqStatistics(std::chrono::microseconds cycleDuration, std::chrono::microseconds loopTime);
     void updateNumberOfChannels();
     void enableCANChannel();
     void updateAcqLoopTime();
@@ -70,6 +80,22 @@ private:
     size_t acqLoopTime;
     bool stopAcq;
 
+    // Channels collect their samples in parallel on the scheduler workers; the graph is rebuilt when channels
+    // are added or removed and is not assigned when the samples are collected on the acquisition thread
+    SchedulerPtr scheduler;
+    TaskPtr acqGraph;
+    std::vector<TaskPtr> acqTasks;
+    std::chrono::microseconds acqCurTime;
+
+    // In load generator mode each cycle reports, timestamped with the cycle time, how late its samples were sent
+    RefLoadGeneratorSettings loadGenerator;
+    SignalConfigPtr lagSignal;
+    SignalConfigPtr lagDomainSignal;
+
+    Int acqOverrunCount;
+    Int acqLag;
+    bool acqOverrun;
+
     FolderConfigPtr aiFolder;
     FolderConfigPtr canFolder;
     ComponentPtr syncComponent;
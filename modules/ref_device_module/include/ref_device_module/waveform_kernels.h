@@ -0,0 +1,160 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#pragma once
+#include <ref_device_module/common.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+BEGIN_NAMESPACE_REF_DEVICE_MODULE
+
+// Block kernels the reference channel uses to synthesize its waveforms. The loops have no calls and no
+// dependencies between neighbouring samples, so the compiler can vectorize them.
+namespace waveform
+{
+
+// Number of samples generated at once; small enough that a chunk of doubles stays in L1 cache.
+constexpr size_t ChunkSize = 256;
+
+// Writes sin(2 * pi * cyclesPerSample * (firstSample + i)) for each sample of the chunk. The sine is evaluated
+// exactly only for the first samples of each of the interleaved lanes; the others are advanced with the
+// angle-addition recurrence, so the rounding error does not build up beyond one chunk.
+inline void sine(double* out, size_t count, double cyclesPerSample, uint64_t firstSample)
+{
+    constexpr size_t Lanes = 4;
+    constexpr double TwoPi = 6.283185307179586;
+
+    const double phase = TwoPi * std::fmod(cyclesPerSample * static_cast<double>(firstSample), 1.0);
+    const double step = TwoPi * cyclesPerSample;
+    const double stepSin = std::sin(step * Lanes);
+    const double stepCos = std::cos(step * Lanes);
+
+    double s[Lanes];
+    double c[Lanes];
+    for (size_t lane = 0; lane < Lanes; ++lane)
+    {
+        s[lane] = std::sin(phase + step * static_cast<double>(lane));
+        c[lane] = std::cos(phase + step * static_cast<double>(lane));
+    }
+
+    size_t i = 0;
+    for (; i + Lanes <= count; i += Lanes)
+    {
+        for (size_t lane = 0; lane < Lanes; ++lane)
+        {
+            out[i + lane] = s[lane];
+
+            const double nextSin = s[lane] * stepCos + c[lane] * stepSin;
+            c[lane] = c[lane] * stepCos - s[lane] * stepSin;
+            s[lane] = nextSin;
+        }
+    }
+
+    for (size_t lane = 0; lane < Lanes && i + lane < count; ++lane)
+        out[i + lane] = s[lane];
+}
+
+// Replaces each value with +1 or -1 depending on its sign; applied to a sine it yields a rectangular wave.
+inline void sign(double* values, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        values[i] = values[i] > 0 ? 1.0 : -1.0;
+}
+
+// Writes (first + i) / divisor for each sample of the chunk.
+inline void counter(double* out, size_t count, uint64_t first, double divisor)
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = static_cast<double>(first + i) / divisor;
+}
+
+inline void fill(double* out, size_t count, double value)
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = value;
+}
+
+inline void scaleOffset(double* values, size_t count, double scale, double offset)
+{
+    for (size_t i = 0; i < count; ++i)
+        values[i] = values[i] * scale + offset;
+}
+
+// Writes (value + offset) * scale converted to an unsigned raw sample; used for signals scaled on the client.
+inline void quantize(const double* values, size_t count, double offset, double scale, uint32_t* out)
+{
+    for (size_t i = 0; i < count; ++i)
+        out[i] = static_cast<uint32_t>((values[i] + offset) * scale);
+}
+
+// Generates approximately normally distributed noise a chunk at a time. Each sample is the sum of four 16-bit
+// uniform values taken from one xorshift64 draw (an Irwin-Hall approximation, limited to about 3.5 standard
+// deviations), which is far cheaper than std::normal_distribution and runs on independent lanes.
+class NoiseGenerator
+{
+public:
+    explicit NoiseGenerator(uint64_t seed)
+    {
+        // splitmix64 spreads a single seed over the lanes; the low bit is set because xorshift must not start at zero
+        for (auto& lane : state)
+        {
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            lane = (z ^ (z >> 31)) | 1u;
+        }
+    }
+
+    // Adds noise with the given standard deviation to the values.
+    void add(double* values, size_t count, double amplitude)
+    {
+        // the sum of four uniform values in [0, 65535] has a mean of 2 * 65535 and a variance of 4 * (2^32 - 1) / 12
+        constexpr double Mean = 2.0 * 65535.0;
+        const double scale = amplitude / std::sqrt(4.0 * 4294967295.0 / 12.0);
+
+        size_t i = 0;
+        for (; i + Lanes <= count; i += Lanes)
+            for (size_t lane = 0; lane < Lanes; ++lane)
+                values[i + lane] += (static_cast<double>(next(lane)) - Mean) * scale;
+
+        for (size_t lane = 0; lane < Lanes && i + lane < count; ++lane)
+            values[i + lane] += (static_cast<double>(next(lane)) - Mean) * scale;
+    }
+
+private:
+    static constexpr size_t Lanes = 4;
+
+    uint64_t state[Lanes];
+
+    // Advances one lane and returns the sum of the four 16-bit fields of its new state.
+    uint32_t next(size_t lane)
+    {
+        uint64_t x = state[lane];
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        state[lane] = x;
+
+        return static_cast<uint32_t>((x & 0xFFFF) + ((x >> 16) & 0xFFFF) + ((x >> 32) & 0xFFFF) + (x >> 48));
+    }
+};
+
+}
+
+END_NAMESPACE_REF_DEVICE_MODULE
@@ -77,6 +77,10 @@ void RefCANChannelImpl::globalSampleRateChanged(double /* globalSampleRate */)
 {
 }
 
+void RefCANChannelImpl::loadGeneratorChanged(const RefLoadGeneratorSettings& /* settings */)
+{
+}
+
 void RefCANChannelImpl::generateSamples(int64_t curTime, uint64_t duration, size_t newSamples)
 {
     const auto domainPacket = DataPacket(timeSignal.getDescriptor(), newSamples, curTime);
@@ -5,6 +5,8 @@
 #include <coreobjects/coercer_factory.h>
 #include <opendaq/range_factory.h>
 #include <opendaq/packet_factory.h>
+#include <opendaq/pool_allocator_factory.h>
+#include <opendaq/signal_utils.h>
 #include <fmt/format.h>
 #include <coreobjects/callable_info_factory.h>
 #include <opendaq/data_rule_factory.h>
@@ -12,9 +14,11 @@
 #include <opendaq/scaling_factory.h>
 #include <opendaq/custom_log.h>
 #include <coreobjects/property_object_protected_ptr.h>
-
-
-#define PI 3.141592653589793
+#include <opendaq/sample_type_traits.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
 
 BEGIN_NAMESPACE_REF_DEVICE_MODULE
 
@@ -33,8 +37,13 @@ RefChannelImpl::RefChannelImpl(const ContextPtr& context, const ComponentPtr& pa
     , microSecondsFromEpochToStartTime(init.microSecondsFromEpochToStartTime)
     , lastCollectTime(0)
     , samplesGenerated(0)
-    , re(std::random_device()())
+    , noise(std::random_device()())
+    , valuePackets(List<IPacket>())
+    , domainPackets(List<IPacket>())
+    , packetAllocator(PoolAllocator())
     , needsSignalTypeChanged(false)
+    , loadGenerator(init.loadGenerator)
+    , loadScale(1.0)
 {
     initProperties();
     waveformChangedInternal();
@@ -43,6 +52,7 @@ RefChannelImpl::RefChannelImpl(const ContextPtr& context, const ComponentPtr& pa
     resetCounter();
     createSignals();
     buildSignalDescriptors();
+    buildLoadTable();
 }
 
 void RefChannelImpl::signalTypeChangedIfNotUpdating(const PropertyValueEventArgsPtr& args)
@@ -195,6 +205,7 @@ void RefChannelImpl::waveformChanged()
 {
     std::scoped_lock lock(sync);
     waveformChangedInternal();
+    buildLoadTable();
 }
 
 void RefChannelImpl::signalTypeChanged()
@@ -202,6 +213,7 @@ void RefChannelImpl::signalTypeChanged()
     std::scoped_lock lock(sync);
     signalTypeChangedInternal();
     buildSignalDescriptors();
+    buildLoadTable();
     updateSamplesGenerated();
 }
 
@@ -239,7 +251,10 @@ void RefChannelImpl::collectSamples(std::chrono::microseconds curTime)
 
     if (newSamples > 0 && valueSignal.getActive())
     {
-        if (!fixedPacketSize)
+        const bool fixedSize = fixedPacketSize || loadGenerator.enabled;
+        const uint64_t size = loadGenerator.enabled ? loadGenerator.packetSize : packetSize;
+
+        if (!fixedSize)
         {
             const auto packetTime = samplesGenerated * deltaT + static_cast<uint64_t>(microSecondsFromEpochToStartTime.count());
             generateSamples(static_cast<int64_t>(packetTime), samplesGenerated, newSamples);
@@ -247,16 +262,18 @@ void RefChannelImpl::collectSamples(std::chrono::microseconds curTime)
         }
         else
         {
-            while (newSamples >= packetSize)
+            while (newSamples >= size)
             {
                 const auto packetTime = samplesGenerated * deltaT + static_cast<uint64_t>(microSecondsFromEpochToStartTime.count());
-                generateSamples(static_cast<int64_t>(packetTime), samplesGenerated, packetSize);
+                generateSamples(static_cast<int64_t>(packetTime), samplesGenerated, size);
 
-                samplesGenerated += packetSize;
-                newSamples -= packetSize;
+                samplesGenerated += size;
+                newSamples -= size;
                 
             }
         }
+
+        sendGeneratedPackets();
     }
 
     lastCollectTime = curTime;
@@ -264,62 +281,171 @@ void RefChannelImpl::collectSamples(std::chrono::microseconds curTime)
 
 void RefChannelImpl::generateSamples(int64_t curTime, uint64_t samplesGenerated, uint64_t newSamples)
 {
-    const auto domainPacket = DataPacket(timeSignal.getDescriptor(), newSamples, curTime);
-    const auto dataPacket = DataPacketWithDomain(domainPacket, valueSignal.getDescriptor(), newSamples);
+    const auto domainPacket = DataPacket(timeSignal.getDescriptor(), newSamples, curTime, packetAllocator);
+    const auto dataPacket = DataPacketWithDomain(domainPacket, valueSignal.getDescriptor(), newSamples, nullptr, packetAllocator);
 
-    double* buffer;
+    void* rawData = dataPacket.getRawData();
 
-    if (clientSideScaling)
+    if (loadGenerator.enabled)
     {
-        buffer = static_cast<double*>(std::malloc(newSamples * sizeof(double)));
+        copyLoadTable(rawData, samplesGenerated, newSamples);
+        valuePackets.pushBack(dataPacket);
+        domainPackets.pushBack(domainPacket);
+        return;
+    }
+
+    // Samples scaled on the client are generated into a chunk on the stack and quantized straight into the packet
+    double chunk[waveform::ChunkSize];
+    const double quantizationScale = std::pow(2, 24) / 20.0;
+
+    for (uint64_t offset = 0; offset < newSamples; offset += waveform::ChunkSize)
+    {
+        const auto count = static_cast<size_t>(std::min<uint64_t>(waveform::ChunkSize, newSamples - offset));
+
+        if (clientSideScaling)
+        {
+            generateChunk(chunk, count, samplesGenerated + offset);
+            waveform::quantize(chunk, count, 10.0, quantizationScale, static_cast<uint32_t*>(rawData) + offset);
+        }
+        else
+            generateChunk(static_cast<double*>(rawData) + offset, count, samplesGenerated + offset);
     }
-    else
-        buffer = static_cast<double*>(dataPacket.getRawData());
 
+    valuePackets.pushBack(dataPacket);
+    domainPackets.pushBack(domainPacket);
+}
+
+void RefChannelImpl::generateChunk(double* out, size_t count, uint64_t firstSample)
+{
     switch(waveformType)
     {
         case WaveformType::Counter:
         {
-            for (uint64_t i = 0; i < newSamples; i++)
-                buffer[i] = static_cast<double>(counter++) / sampleRate;
-            break;
+            waveform::counter(out, count, counter, sampleRate);
+            counter += count;
+            return;
         }
         case WaveformType::Sine:
         {
-            for (uint64_t i = 0; i < newSamples; i++)
-                buffer[i] = std::sin(2.0 * PI * freq / sampleRate * static_cast<double>((samplesGenerated + i))) * ampl + dc + noiseAmpl * dist(re);
+            waveform::sine(out, count, freq / sampleRate, firstSample);
+            waveform::scaleOffset(out, count, ampl, dc);
             break;
         }
         case WaveformType::Rect:
         {
-            for (uint64_t i = 0; i < newSamples; i++)
-            {
-                double val = std::sin(2.0 * PI * freq / sampleRate * static_cast<double>((samplesGenerated + i)));
-                val = val > 0 ? 1.0 : -1.0;
-                buffer[i] = val * ampl + dc + noiseAmpl * dist(re);
-            }
+            waveform::sine(out, count, freq / sampleRate, firstSample);
+            waveform::sign(out, count);
+            waveform::scaleOffset(out, count, ampl, dc);
             break;
         }
         case WaveformType::None:
         {
-            for (uint64_t i = 0; i < newSamples; i++)
-                buffer[i] = dc + noiseAmpl * dist(re);
+            waveform::fill(out, count, dc);
             break;
         }
     }
 
-    if (clientSideScaling)
+    if (noiseAmpl != 0.0)
+        noise.add(out, count, noiseAmpl);
+}
+
+void RefChannelImpl::buildLoadTable()
+{
+    if (!loadGenerator.enabled)
     {
-        double f = std::pow(2, 24);
-        auto packetBuffer = static_cast<uint32_t*>(dataPacket.getRawData());
-        for (size_t i = 0; i < newSamples; i++)
-            *packetBuffer++ = static_cast<uint32_t>((buffer[i] + 10.0) / 20.0 * f);
+        loadTable = {};
+        return;
+    }
 
-        std::free(static_cast<void*>(buffer));
+    std::vector<double> values(LoadTableSamples);
+
+    // The frequency is rounded to a whole number of periods per table, so that the table repeats seamlessly
+    const double cyclesPerTable = std::max(1.0, std::round(freq / sampleRate * LoadTableSamples));
+    const double cyclesPerSample = cyclesPerTable / LoadTableSamples;
+
+    switch (waveformType)
+    {
+        case WaveformType::Counter:
+            waveform::counter(values.data(), LoadTableSamples, 0, sampleRate);
+            break;
+        case WaveformType::Sine:
+            waveform::sine(values.data(), LoadTableSamples, cyclesPerSample, 0);
+            waveform::scaleOffset(values.data(), LoadTableSamples, ampl, dc);
+            break;
+        case WaveformType::Rect:
+            waveform::sine(values.data(), LoadTableSamples, cyclesPerSample, 0);
+            waveform::sign(values.data(), LoadTableSamples);
+            waveform::scaleOffset(values.data(), LoadTableSamples, ampl, dc);
+            break;
+        case WaveformType::None:
+            waveform::fill(values.data(), LoadTableSamples, dc);
+            break;
     }
 
-    valueSignal.sendPacket(dataPacket);
-    timeSignal.sendPacket(domainPacket);
+    if (waveformType != WaveformType::Counter && noiseAmpl != 0.0)
+        noise.add(values.data(), LoadTableSamples, noiseAmpl);
+
+    const auto toRaw = [this, &values](auto* raw)
+    {
+        using T = std::remove_pointer_t<decltype(raw)>;
+        for (size_t i = 0; i < LoadTableSamples; i++)
+        {
+            if constexpr (std::is_integral_v<T>)
+            {
+                const double scaled = std::round(values[i] / loadScale);
+                raw[i] = static_cast<T>(std::clamp(scaled,
+                                                   static_cast<double>(std::numeric_limits<T>::min()),
+                                                   static_cast<double>(std::numeric_limits<T>::max())));
+            }
+            else
+                raw[i] = static_cast<T>(values[i]);
+        }
+    };
+
+    loadTable.resize(LoadTableSamples * getSampleSize(loadGenerator.sampleType));
+    switch (loadGenerator.sampleType)
+    {
+        case SampleType::Float32:
+            toRaw(reinterpret_cast<float*>(loadTable.data()));
+            break;
+        case SampleType::Int32:
+            toRaw(reinterpret_cast<int32_t*>(loadTable.data()));
+            break;
+        case SampleType::Int16:
+            toRaw(reinterpret_cast<int16_t*>(loadTable.data()));
+            break;
+        default:
+            std::memcpy(loadTable.data(), values.data(), loadTable.size());
+            break;
+    }
+}
+
+void RefChannelImpl::copyLoadTable(void* out, uint64_t firstSample, uint64_t sampleCount) const
+{
+    const size_t sampleSize = loadTable.size() / LoadTableSamples;
+    auto dst = static_cast<uint8_t*>(out);
+
+    auto position = static_cast<size_t>(firstSample % LoadTableSamples);
+    while (sampleCount > 0)
+    {
+        const auto count = static_cast<size_t>(std::min<uint64_t>(sampleCount, LoadTableSamples - position));
+        std::memcpy(dst, loadTable.data() + position * sampleSize, count * sampleSize);
+
+        dst += count * sampleSize;
+        sampleCount -= count;
+        position = 0;
+    }
+}
+
+void RefChannelImpl::sendGeneratedPackets()
+{
+    if (valuePackets.getCount() == 0)
+        return;
+
+    sendPacketsOnSignals({{valueSignal, valuePackets}, {timeSignal, domainPackets}});
+
+    valuePackets.clear();
+    domainPackets.clear();
 }
 
 Int RefChannelImpl::getDeltaT(const double sr) const
@@ -338,7 +464,31 @@ void RefChannelImpl::buildSignalDescriptors()
                                  .setValueRange(customRange)
                                  .setName("AI " + std::to_string(index + 1));
 
-    if (clientSideScaling)
+    if (loadGenerator.enabled)
+    {
+        const RangePtr range = customRange;
+        double rangeLimit = std::max(std::abs(static_cast<Float>(range.getLowValue())), std::abs(static_cast<Float>(range.getHighValue())));
+        if (rangeLimit <= 0.0)
+            rangeLimit = 1.0;
+
+        switch (loadGenerator.sampleType)
+        {
+            case SampleType::Int32:
+                loadScale = rangeLimit / std::numeric_limits<int32_t>::max();
+                valueDescriptor.setPostScaling(LinearScaling(loadScale, 0, SampleType::Int32, ScaledSampleType::Float64));
+                break;
+            case SampleType::Int16:
+                loadScale = rangeLimit / std::numeric_limits<int16_t>::max();
+                valueDescriptor.setPostScaling(LinearScaling(loadScale, 0, SampleType::Int16, ScaledSampleType::Float64));
+                break;
+            case SampleType::Float32:
+                valueDescriptor.setSampleType(SampleType::Float32);
+                break;
+            default:
+                break;
+        }
+    }
+    else if (clientSideScaling)
     {
         const double scale = 20.0 / std::pow(2, 24);
         constexpr double offset = -10.0;
@@ -398,9 +548,19 @@ void RefChannelImpl::globalSampleRateChanged(double newGlobalSampleRate)
     globalSampleRate = coerceSampleRate(newGlobalSampleRate);
     signalTypeChangedInternal();
     buildSignalDescriptors();
+    buildLoadTable();
     updateSamplesGenerated();
 }
 
+void RefChannelImpl::loadGeneratorChanged(const RefLoadGeneratorSettings& settings)
+{
+    std::scoped_lock lock(sync);
+
+    loadGenerator = settings;
+    buildSignalDescriptors();
+    buildLoadTable();
+}
+
 std::string RefChannelImpl::getEpoch()
 {
     const std::time_t epochTime = std::chrono::system_clock::to_time_t(std::chrono::time_point<std::chrono::system_clock>{});
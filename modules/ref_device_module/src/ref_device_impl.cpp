@@ -7,6 +7,14 @@
 #include <fmt/format.h>
 #include <opendaq/custom_log.h>
 #include <opendaq/device_type_factory.h>
+#include <opendaq/task_factory.h>
+#include <opendaq/data_descriptor_factory.h>
+#include <opendaq/packet_factory.h>
+#include <coreobjects/eval_value_factory.h>
+#include <opendaq/component_status_container_private_ptr.h>
+#include <coreobjects/property_object_protected_ptr.h>
+#include <coretypes/enumeration_factory.h>
+#include <coretypes/enumeration_type_factory.h>
 
 #include <utility>
 
@@ -18,6 +26,12 @@ RefDeviceImpl::RefDeviceImpl(size_t id, const ContextPtr& ctx, const ComponentPt
     , microSecondsFromEpochToDeviceStart(0)
     , acqLoopTime(0)
     , stopAcq(false)
+    , scheduler(ctx.getScheduler())
+    , acqCurTime(0)
+    , loadGenerator{false, SampleType::Float64, 1000}
+    , acqOverrunCount(0)
+    , acqLag(0)
+    , acqOverrun(false)
     , logger(ctx.getLogger())
     , loggerComponent( this->logger.assigned()
                           ? this->logger.getOrAddComponent("ReferenceDevice")
@@ -27,6 +41,9 @@ RefDeviceImpl::RefDeviceImpl(size_t id, const ContextPtr& ctx, const ComponentPt
     initSyncComponent();
     initClock();
     initProperties();
+    initStatuses();
+    initLoadGeneratorSignals();
+    updateLoadGenerator();
     updateNumberOfChannels();
     enableCANChannel();
     updateAcqLoopTime();
@@ -193,30 +210,173 @@ void RefDeviceImpl::initSyncComponent()
         [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { };
 }
 
+void RefDeviceImpl::initStatuses()
+{
+    if (!this->context.getTypeManager().hasType("AcquisitionStatusType"))
+    {
+        const auto statusType = EnumerationType("AcquisitionStatusType", List<IString>("Ok", "Overrun"));
+        this->context.getTypeManager().addType(statusType);
+    }
+
+    const auto statusInitValue = Enumeration("AcquisitionStatusType", "Ok", this->context.getTypeManager());
+    this->statusContainer.asPtr<IComponentStatusContainerPrivate>().addStatus("AcquisitionStatus", statusInitValue);
+}
+
+void RefDeviceImpl::initLoadGeneratorSignals()
+{
+    const auto lagDomainDescriptor = DataDescriptorBuilder()
+                                     .setSampleType(SampleType::Int64)
+                                     .setUnit(Unit("s", -1, "seconds", "time"))
+                                     .setTickResolution(RefChannelImpl::getResolution())
+                                     .setOrigin(RefChannelImpl::getEpoch())
+                                     .setName("Time LoadGeneratorLag")
+                                     .build();
+
+    const auto lagDescriptor = DataDescriptorBuilder()
+                               .setSampleType(SampleType::Int64)
+                               .setUnit(Unit("us", -1, "microseconds", "time"))
+                               .setName("LoadGeneratorLag")
+                               .build();
+
+    lagDomainSignal = createAndAddSignal("load_generator_lag_time", lagDomainDescriptor, false);
+    lagSignal = createAndAddSignal("load_generator_lag", lagDescriptor);
+    lagSignal.setDomainSignal(lagDomainSignal);
+}
+
+void RefDeviceImpl::updateLoadGenerator()
+{
+    static const SampleType sampleTypes[] = {SampleType::Float64, SampleType::Float32, SampleType::Int32, SampleType::Int16};
+
+    const bool enabled = objPtr.getPropertyValue("LoadGenerator");
+    const Int sampleTypeIndex = objPtr.getPropertyValue("LoadSampleType");
+    const Int packetSize = objPtr.getPropertyValue("LoadPacketSize");
+    LOG_I("Properties: LoadGenerator {}, LoadSampleType {}, LoadPacketSize {}", enabled, sampleTypeIndex, packetSize);
+
+    std::scoped_lock lock(sync);
+
+    loadGenerator = {enabled, sampleTypes[sampleTypeIndex], static_cast<uint64_t>(packetSize)};
+    for (auto& ch : channels)
+    {
+        auto chPrivate = ch.asPtr<IRefChannel>();
+        chPrivate->loadGeneratorChanged(loadGenerator);
+    }
+}
+
+void RefDeviceImpl::sendLoadGeneratorLag(std::chrono::microseconds curTime)
+{
+    const auto lag = getMicroSecondsSinceDeviceStart() - curTime;
+
+    const auto domainPacket = DataPacket(lagDomainSignal.getDescriptor(), 1);
+    *static_cast<int64_t*>(domainPacket.getRawData()) = (microSecondsFromEpochToDeviceStart + curTime).count();
+
+    const auto dataPacket = DataPacketWithDomain(domainPacket, lagSignal.getDescriptor(), 1);
+    *static_cast<int64_t*>(dataPacket.getRawData()) = lag.count();
+
+    lagSignal.sendPacket(dataPacket);
+    lagDomainSignal.sendPacket(domainPacket);
+}
+
 void RefDeviceImpl::acqLoop()
 {
     using namespace std::chrono_literals;
 
     std::unique_lock<std::mutex> lock(sync);
+    auto nextCycle = std::chrono::steady_clock::now();
     while (!stopAcq)
     {
-        cv.wait_for(lock, std::chrono::milliseconds(acqLoopTime));
+        const auto loopTime = std::chrono::milliseconds(acqLoopTime);
+
+        // Cycles are scheduled from the start of the previous one, so a slow cycle shortens the next wait
+        nextCycle += loopTime;
+        cv.wait_until(lock, nextCycle);
         if (!stopAcq)
         {
-            auto curTime = getMicroSecondsSinceDeviceStart();
+            const auto cycleStart = std::chrono::steady_clock::now();
+            const auto curTime = getMicroSecondsSinceDeviceStart();
+            collectSamples(curTime);
+            if (loadGenerator.enabled)
+                sendLoadGeneratorLag(curTime);
+            const auto cycleEnd = std::chrono::steady_clock::now();
+
+            if (nextCycle < cycleStart)
+                nextCycle = cycleStart;
+
+            lock.unlock();
+            updateAcqStatistics(std::chrono::duration_cast<std::chrono::microseconds>(cycleEnd - cycleStart), loopTime);
+            lock.lock();
+        }
+    }
+}
 
-            for (auto& ch : channels)
-            {
-                auto chPrivate = ch.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
+void RefDeviceImpl::collectSamples(std::chrono::microseconds curTime)
+{
+    if (acqGraph.assigned())
+    {
+        acqCurTime = curTime;
+        scheduler.scheduleGraph(acqGraph).wait();
+        return;
+    }
 
-            if (canChannel.assigned())
-            {
-                auto chPrivate = canChannel.asPtr<IRefChannel>();
-                chPrivate->collectSamples(curTime);
-            }
-        }
+    for (auto& ch : channels)
+    {
+        auto chPrivate = ch.asPtr<IRefChannel>();
+        chPrivate->collectSamples(curTime);
+    }
+
+    if (canChannel.assigned())
+    {
+        auto chPrivate = canChannel.asPtr<IRefChannel>();
+        chPrivate->collectSamples(curTime);
+    }
+}
+
+void RefDeviceImpl::buildAcqGraph()
+{
+    acqGraph.release();
+    acqTasks.clear();
+
+    std::vector<ChannelPtr> acqChannels = channels;
+    if (canChannel.assigned())
+        acqChannels.push_back(canChannel);
+
+    if (acqChannels.size() < 2 || !scheduler.assigned() || !scheduler.isMultiThreaded())
+        return;
+
+    acqGraph = TaskGraph("RefDeviceAcquisition");
+    for (const auto& ch : acqChannels)
+    {
+        auto task = Task([this, chPrivate = ch.asPtr<IRefChannel>()] { chPrivate->collectSamples(acqCurTime); }, ch.getLocalId());
+        acqGraph.then(task);
+        acqTasks.push_back(std::move(task));
+    }
+}
+
+void RefDeviceImpl::updateAcqStatistics(std::chrono::microseconds cycleDuration, std::chrono::microseconds loopTime)
+{
+    const bool overrun = cycleDuration > loopTime;
+    const Int lag = overrun ? static_cast<Int>((cycleDuration - loopTime).count()) : 0;
+
+    const auto protectedObj = objPtr.asPtr<IPropertyObjectProtected>();
+    if (overrun)
+    {
+        ++acqOverrunCount;
+        protectedObj.setProtectedPropertyValue("AcquisitionOverrunCount", acqOverrunCount);
+    }
+
+    if (lag != acqLag)
+    {
+        acqLag = lag;
+        protectedObj.setProtectedPropertyValue("AcquisitionLag", acqLag);
+    }
+
+    if (overrun != acqOverrun)
+    {
+        acqOverrun = overrun;
+        if (overrun)
+            LOG_W("Acquisition cycle took {} us, longer than the loop time of {} us", cycleDuration.count(), loopTime.count())
+
+        const auto statusValue = Enumeration("AcquisitionStatusType", overrun ? "Overrun" : "Ok", this->context.getTypeManager());
+        this->statusContainer.asPtr<IComponentStatusContainerPrivate>().setStatus("AcquisitionStatus", statusValue);
     }
 }
 
@@ -245,6 +405,23 @@ void RefDeviceImpl::initProperties()
     objPtr.getOnPropertyValueWrite("EnableCANChannel") +=
         [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { enableCANChannel(); };
 
+    objPtr.addProperty(BoolProperty("LoadGenerator", False));
+    objPtr.getOnPropertyValueWrite("LoadGenerator") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { updateLoadGenerator(); };
+
+    objPtr.addProperty(SelectionPropertyBuilder("LoadSampleType", List<IString>("Float64", "Float32", "Int32", "Int16"), 0)
+                           .setVisible(EvalValue("$LoadGenerator"))
+                           .build());
+    objPtr.getOnPropertyValueWrite("LoadSampleType") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { updateLoadGenerator(); };
+
+    objPtr.addProperty(IntPropertyBuilder("LoadPacketSize", 1000).setMinValue(1).setVisible(EvalValue("$LoadGenerator")).build());
+    objPtr.getOnPropertyValueWrite("LoadPacketSize") +=
+        [this](PropertyObjectPtr& obj, PropertyValueEventArgsPtr& args) { updateLoadGenerator(); };
+
+    objPtr.addProperty(IntPropertyBuilder("AcquisitionOverrunCount", 0).setReadOnly(True).build());
+    objPtr.addProperty(IntPropertyBuilder("AcquisitionLag", 0).setUnit(Unit("us")).setReadOnly(True).build());
+
     auto options = context.getModuleOptions("RefDevice");
     if (options.getCount() == 0)
         return;
@@ -262,6 +439,23 @@ void RefDeviceImpl::initProperties()
         if (value.getCoreType() == CoreType::ctBool)
             objPtr.setPropertyValue("EnableCANChannel", value);
     }
+
+    for (const auto& name : {"LoadSampleType", "LoadPacketSize"})
+    {
+        if (!options.hasKey(name))
+            continue;
+
+        auto value = options.get(name);
+        if (value.getCoreType() == CoreType::ctInt)
+            objPtr.setPropertyValue(name, value);
+    }
+
+    if (options.hasKey("LoadGenerator"))
+    {
+        auto value = options.get("LoadGenerator");
+        if (value.getCoreType() == CoreType::ctBool)
+            objPtr.setPropertyValue("LoadGenerator", value);
+    }
 }
 
 void RefDeviceImpl::updateNumberOfChannels()
@@ -284,11 +478,13 @@ void RefDeviceImpl::updateNumberOfChannels()
     auto microSecondsSinceDeviceStart = getMicroSecondsSinceDeviceStart();
     for (auto i = channels.size(); i < num; i++)
     {
-        RefChannelInit init{ i, globalSampleRate, microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart };
+        RefChannelInit init{ i, globalSampleRate, microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart, loadGenerator };
         auto localId = fmt::format("refch{}", i);
         auto ch = createAndAddChannel<RefChannelImpl>(aiFolder, localId, init);
         channels.push_back(std::move(ch));
     }
+
+    buildAcqGraph();
 }
 
 void RefDeviceImpl::enableCANChannel()
@@ -309,6 +505,8 @@ void RefDeviceImpl::enableCANChannel()
         RefCANChannelInit init{microSecondsSinceDeviceStart, microSecondsFromEpochToDeviceStart};
         canChannel = createAndAddChannel<RefCANChannelImpl>(canFolder, "refcanch", init);
     }
+
+    buildAcqGraph();
 }
 
 void RefDeviceImpl::updateGlobalSampleRate()
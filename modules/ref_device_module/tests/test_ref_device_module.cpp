@@ -1,6 +1,7 @@
 #include <testutils/testutils.h>
 #include <ref_device_module/module_dll.h>
 #include <ref_device_module/version.h>
+#include <ref_device_module/waveform_kernels.h>
 #include <gmock/gmock.h>
 #include <opendaq/module_ptr.h>
 #include <opendaq/device_ptr.h>
@@ -8,6 +9,7 @@
 #include <opendaq/removable_ptr.h>
 #include <opendaq/range_factory.h>
 #include <coretypes/common.h>
+#include <coretypes/intfs.h>
 #include <opendaq/context_factory.h>
 #include <opendaq/search_filter_factory.h>
 #include <opendaq/reader_factory.h>
@@ -15,8 +17,12 @@
 #include <opendaq/event_packet_ptr.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_params.h>
+#include <opendaq/scheduler_factory.h>
 
+#include <algorithm>
+#include <cmath>
 #include <thread>
+#include <vector>
 
 using RefDeviceModuleTest = testing::Test;
 using namespace daq;
@@ -716,3 +722,174 @@ TEST_F(RefDeviceModuleTest, ReadAIChannelWithFixedPacketSize)
             break;
     };
 }
+
+// Blocks the acquisition thread that sends the packets for longer than an acquisition cycle
+class SlowPortListenerImpl : public ImplementationOf<IInputPortNotifications>
+{
+public:
+    ErrCode INTERFACE_FUNC acceptsSignal(IInputPort* port, ISignal* signal, Bool* accept) override
+    {
+        *accept = True;
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC connected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC disconnected(IInputPort* port) override
+    {
+        return OPENDAQ_SUCCESS;
+    }
+
+    ErrCode INTERFACE_FUNC packetReceived(IInputPort* port) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        return OPENDAQ_SUCCESS;
+    }
+};
+
+TEST_F(RefDeviceModuleTest, DeviceAcquisitionStatistics)
+{
+    auto module = CreateModule();
+    const auto device = module.createDevice("daqref://device1", nullptr);
+
+    ASSERT_TRUE(device.getProperty("AcquisitionOverrunCount").getReadOnly());
+    ASSERT_TRUE(device.getProperty("AcquisitionLag").getReadOnly());
+
+    // the default channels take a fraction of the default loop time to acquire
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ASSERT_EQ(device.getStatusContainer().getStatus("AcquisitionStatus"), "Ok");
+    ASSERT_EQ(static_cast<Int>(device.getPropertyValue("AcquisitionOverrunCount")), 0);
+    ASSERT_EQ(static_cast<Int>(device.getPropertyValue("AcquisitionLag")), 0);
+
+    // a listener notified on the acquisition thread makes every cycle longer than the shortest loop time
+    device.setPropertyValue("AcquisitionLoopTime", 10);
+
+    const InputPortNotificationsPtr listener = createWithImplementation<IInputPortNotifications, SlowPortListenerImpl>();
+    const auto inputPort = InputPort(NullContext(), nullptr, "input");
+    inputPort.setNotificationMethod(PacketReadyNotification::SameThread);
+    inputPort.setListener(listener);
+    inputPort.connect(device.getChannels()[0].getSignals()[0]);
+
+    for (int i = 0; i < 100 && static_cast<Int>(device.getPropertyValue("AcquisitionOverrunCount")) == 0; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    inputPort.disconnect();
+
+    ASSERT_GT(static_cast<Int>(device.getPropertyValue("AcquisitionOverrunCount")), 0);
+}
+
+TEST_F(RefDeviceModuleTest, ReadChannelsWithParallelAcquisition)
+{
+    const auto logger = Logger();
+    const auto context = Context(Scheduler(logger, 4), logger, TypeManager(), nullptr);
+
+    ModulePtr module;
+    createModule(&module, context);
+
+    const auto device = module.createDevice("daqref://device1", nullptr);
+    device.setPropertyValue("NumberOfChannels", 8);
+    device.setPropertyValue("EnableCANChannel", True);
+
+    std::vector<PacketReaderPtr> readers;
+    for (const auto& channel : device.getChannels())
+        readers.push_back(PacketReader(channel.getSignals()[0]));
+
+    // every channel delivers its descriptor followed by data
+    for (const auto& reader : readers)
+        while (reader.getAvailableCount() < 2u)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    device.setPropertyValue("NumberOfChannels", 1);
+    device.setPropertyValue("EnableCANChannel", False);
+}
+
+TEST_F(RefDeviceModuleTest, WaveformSineKernel)
+{
+    using namespace modules::ref_device_module;
+
+    double samples[waveform::ChunkSize];
+    const double cyclesPerSample = 0.0123;
+
+    for (const uint64_t firstSample : {uint64_t(0), uint64_t(1000), uint64_t(123457)})
+    {
+        for (const size_t count : {waveform::ChunkSize, size_t(7), size_t(1)})
+        {
+            waveform::sine(samples, count, cyclesPerSample, firstSample);
+
+            for (size_t i = 0; i < count; i++)
+            {
+                const double cycles = std::fmod(cyclesPerSample * static_cast<double>(firstSample + i), 1.0);
+                ASSERT_NEAR(samples[i], std::sin(2.0 * 3.141592653589793 * cycles), 1e-9);
+            }
+        }
+    }
+}
+
+TEST_F(RefDeviceModuleTest, WaveformNoiseKernel)
+{
+    using namespace modules::ref_device_module;
+
+    constexpr size_t sampleCount = 100000;
+    std::vector<double> samples(sampleCount, 1.0);
+
+    waveform::NoiseGenerator noise(42);
+    for (size_t offset = 0; offset < sampleCount; offset += waveform::ChunkSize)
+        noise.add(samples.data() + offset, std::min(waveform::ChunkSize, sampleCount - offset), 0.5);
+
+    double mean = 0.0;
+    for (const double sample : samples)
+        mean += sample;
+    mean /= sampleCount;
+
+    double variance = 0.0;
+    for (const double sample : samples)
+        variance += (sample - mean) * (sample - mean);
+    variance /= sampleCount;
+
+    ASSERT_NEAR(mean, 1.0, 0.01);
+    ASSERT_NEAR(std::sqrt(variance), 0.5, 0.01);
+}
+
+TEST_F(RefDeviceModuleTest, LoadGenerator)
+{
+    constexpr SizeT packetSize = 100;
+
+    auto module = CreateModule();
+    const auto device = module.createDevice("daqref://device1", nullptr);
+    device.setPropertyValue("NumberOfChannels", 16);
+    device.setPropertyValue("LoadSampleType", 3);
+    device.setPropertyValue("LoadPacketSize", packetSize);
+    device.setPropertyValue("LoadGenerator", True);
+
+    const auto signal = device.getChannels()[15].getSignals()[0];
+    ASSERT_EQ(signal.getDescriptor().getPostScaling().getInputSampleType(), SampleType::Int16);
+
+    const auto lagSignal = device.getSignals(search::LocalId("load_generator_lag"))[0];
+    const auto lagReader = PacketReader(lagSignal);
+    const auto packetReader = PacketReader(signal);
+
+    for (;;)
+    {
+        while (packetReader.getAvailableCount() < 1u)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        const auto packet = packetReader.read();
+        if (packet.getType() != PacketType::Data)
+            continue;
+
+        // there might be packets generated before the load generator was enabled
+        const DataPacketPtr dataPacket = packet;
+        if (dataPacket.getSampleCount() == packetSize && dataPacket.getDataDescriptor() == signal.getDescriptor())
+            break;
+    }
+
+    while (lagReader.getAvailableCount() < 2u)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    device.setPropertyValue("LoadGenerator", False);
+    ASSERT_EQ(signal.getDescriptor().getSampleType(), SampleType::Float64);
+    ASSERT_FALSE(signal.getDescriptor().getPostScaling().assigned());
+}
@@ -51,6 +51,10 @@ private:
     SignalConfigPtr outputSignal;
     SignalConfigPtr outputDomainSignal;
 
+    // Output packets of all input packets dequeued in one notification, sent as a single batch
+    ListPtr<IPacket> outputPackets;
+    ListPtr<IPacket> outputDomainPackets;
+
     Float scale;
     Float offset;
     Float outputHighValue;
@@ -66,6 +70,7 @@ private:
     void processDataPacket(const DataPacketPtr& packet);
 
     void processEventPacket(const EventPacketPtr& packet);
+    void sendOutputPackets();
     void onPacketReceived(const InputPortPtr& port) override;
     void onDisconnected(const InputPortPtr& port) override;
 
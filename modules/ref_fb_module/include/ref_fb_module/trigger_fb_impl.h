@@ -48,6 +48,10 @@ private:
     SignalConfigPtr outputSignal;
     SignalConfigPtr outputDomainSignal;
 
+    // Output packets of all triggers within one input packet, sent as a single batch
+    ListPtr<IPacket> outputPackets;
+    ListPtr<IPacket> outputDomainPackets;
+
     Float threshold;
     bool state;
     PacketReadyNotification packetReadyNotification;
@@ -56,6 +60,7 @@ private:
     void createSignals();
 
     void trigger(const DataPacketPtr& inputPacket, size_t triggerIndex);
+    void sendOutputPackets();
 
     template <SampleType InputSampleType>
     void processDataPacket(const DataPacketPtr& packet);
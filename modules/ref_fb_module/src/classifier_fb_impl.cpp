@@ -9,6 +9,7 @@
 #include <coreobjects/unit_factory.h>
 #include <opendaq/data_packet.h>
 #include <opendaq/data_packet_ptr.h>
+#include <opendaq/domain_view.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/range_factory.h>
@@ -422,7 +423,7 @@ void ClassifierFbImpl::processDataPacket(const DataPacketPtr& packet)
 
     UInt outputPackets = 0;
     {
-        auto inputDomainData = static_cast<UInt*>(packet.getDomainPacket().getData());
+        const DomainView<UInt> inputDomainData(packet.getDomainPacket());
         UInt lastTime = inputDomainData[packet.getSampleCount() - 1];
 
         // initialize members
@@ -455,7 +456,7 @@ void ClassifierFbImpl::processDataPacket(const DataPacketPtr& packet)
 
         auto sampleCnt = listPacket.getSampleCount();
         auto inputData = static_cast<InputType*>(listPacket.getData());
-        auto inputDomainData = static_cast<UInt*>(listPacket.getDomainPacket().getData());
+        const DomainView<UInt> inputDomainData(listPacket.getDomainPacket());
        
         // reset array for new package
         if (packetValueCount == 0)
@@ -5,6 +5,7 @@
 
 #include <opendaq/event_packet_ptr.h>
 #include <opendaq/signal_factory.h>
+#include <opendaq/signal_utils.h>
 
 #include <opendaq/custom_log.h>
 #include <opendaq/event_packet_params.h>
@@ -30,6 +31,8 @@ static const char* InputInvalid = "Invalid";
 
 ScalingFbImpl::ScalingFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId)
     : FunctionBlock(CreateType(), ctx, parent, localId)
+    , outputPackets(List<IPacket>())
+    , outputDomainPackets(List<IPacket>())
 {
     createInputPorts();
     createSignals();
@@ -195,6 +198,8 @@ void ScalingFbImpl::onPacketReceived(const InputPortPtr& port)
         switch (packet.getType())
         {
             case PacketType::Event:
+                // output packets queued so far were produced with the previous descriptor
+                sendOutputPackets();
                 processEventPacket(packet);
                 break;
 
@@ -208,6 +213,19 @@ void ScalingFbImpl::onPacketReceived(const InputPortPtr& port)
 
         packet = connection.dequeue();
     };
+
+    sendOutputPackets();
+}
+
+void ScalingFbImpl::sendOutputPackets()
+{
+    if (outputPackets.getCount() == 0)
+        return;
+
+    sendPacketsOnSignals({{outputSignal, outputPackets}, {outputDomainSignal, outputDomainPackets}});
+
+    outputPackets.clear();
+    outputDomainPackets.clear();
 }
 
 void ScalingFbImpl::processEventPacket(const EventPacketPtr& packet)
@@ -233,8 +251,8 @@ void ScalingFbImpl::processDataPacket(const DataPacketPtr& packet)
     for (size_t i = 0; i < sampleCount; i++)
         *outputData++ = scale * static_cast<Float>(*inputData++) + offset;
 
-    outputSignal.sendPacket(outputPacket);
-    outputDomainSignal.sendPacket(packet.getDomainPacket());
+    outputPackets.pushBack(outputPacket);
+    outputDomainPackets.pushBack(packet.getDomainPacket());
 }
 
 void ScalingFbImpl::createInputPorts()
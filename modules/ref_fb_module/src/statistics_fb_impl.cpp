@@ -1,6 +1,7 @@
 #include <opendaq/custom_log.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/packet_factory.h>
+#include <opendaq/domain_view.h>
 #include <ref_fb_module/statistics_fb_impl.h>
 
 BEGIN_NAMESPACE_REF_FB_MODULE
@@ -361,7 +362,7 @@ void StatisticsFbImpl::processDataPacketTrigger(const DataPacketPtr& packet)
     // Data packet from trigger only holds one value by design
     auto triggerData = data[0];
     // Domain packet from trigger only holds one value by design
-    auto domainStamp = static_cast<Int*>(domainPacket.getData())[0];
+    auto domainStamp = DomainView<Int>(domainPacket).getFirstValue();
     triggerHistory.addElement(triggerData, domainStamp);
 }
 
@@ -1,4 +1,5 @@
 #include <opendaq/event_packet_params.h>
+#include <opendaq/signal_utils.h>
 #include <ref_fb_module/dispatch.h>
 #include <ref_fb_module/trigger_fb_impl.h>
 #include "opendaq/packet_factory.h"
@@ -11,6 +12,8 @@ namespace Trigger
 
 TriggerFbImpl::TriggerFbImpl(const ContextPtr& ctx, const ComponentPtr& parent, const StringPtr& localId, const PropertyObjectPtr& config)
     : FunctionBlock(CreateType(), ctx, parent, localId)
+    , outputPackets(List<IPacket>())
+    , outputDomainPackets(List<IPacket>())
 {
     state = false;
 
@@ -177,9 +180,19 @@ void TriggerFbImpl::trigger(const DataPacketPtr& inputPacket, size_t triggerInde
     auto packetData = static_cast<daq::Bool*>(dataPacket.getData());
     *packetData = static_cast<daq::Bool>(state);
 
-    // Send packets
-    outputDomainSignal.sendPacket(outputDomainPacket);
-    outputSignal.sendPacket(dataPacket);
+    outputDomainPackets.pushBack(outputDomainPacket);
+    outputPackets.pushBack(dataPacket);
+}
+
+void TriggerFbImpl::sendOutputPackets()
+{
+    if (outputPackets.getCount() == 0)
+        return;
+
+    sendPacketsOnSignals({{outputDomainSignal, outputDomainPackets}, {outputSignal, outputPackets}});
+
+    outputDomainPackets.clear();
+    outputPackets.clear();
 }
 
 template <SampleType InputSampleType>
@@ -207,6 +220,8 @@ void TriggerFbImpl::processDataPacket(const DataPacketPtr& packet)
             }
         }
     }
+
+    sendOutputPackets();
 }
 
 void TriggerFbImpl::createInputPorts()
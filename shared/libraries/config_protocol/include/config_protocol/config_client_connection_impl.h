@@ -40,6 +40,7 @@ public:
     ErrCode INTERFACE_FUNC getSamplesUntilNextDescriptor(SizeT* samples) override;
 
     ErrCode INTERFACE_FUNC isRemote(Bool* remote) override;
+    ErrCode INTERFACE_FUNC enqueueMultiple(IList* packets) override;
 
 private:
     InputPortConfigPtr port;
@@ -64,6 +65,11 @@ inline ErrCode ConfigClientConnectionImpl::enqueueOnThisThread(IPacket* packet)
     return OPENDAQ_IGNORED;
 }
 
+inline ErrCode ConfigClientConnectionImpl::enqueueMultiple(IList* packets)
+{
+    return OPENDAQ_IGNORED;
+}
+
 inline ErrCode ConfigClientConnectionImpl::dequeue(IPacket** packet)
 {
     OPENDAQ_PARAM_NOT_NULL(packet);
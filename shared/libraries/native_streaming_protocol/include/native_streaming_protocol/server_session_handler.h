@@ -23,6 +23,9 @@
 
 #include <packet_streaming/packet_streaming_server.h>
 
+#include <string>
+#include <unordered_map>
+
 BEGIN_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
 
 class ServerSessionHandler : public BaseSessionHandler
@@ -40,9 +43,19 @@ public:
     void sendSignalUnavailable(const SignalNumericIdType& signalNumericId, const SignalPtr& signal);
     void sendInitializationDone();
     void sendPacket(const SignalNumericIdType signalId, const PacketPtr& packet);
+    void sendEncodedPacket(packet_streaming::SharedPacketEncoding& encoding);
     void sendSubscribingDone(const SignalNumericIdType signalNumericId);
     void sendUnsubscribingDone(const SignalNumericIdType signalNumericId);
 
+    void setPacketStreamingVersion(uint8_t version);
+    void setPacketStreamingCompression(bool enabled);
+    bool isPacketStreamingCompressionEnabled() const;
+
+    // Per-signal overrides of the session compression setting, by signal string ID. They are applied to
+    // the signal's numeric ID when it is subscribed, by `applyPacketStreamingSignalCompression`.
+    void setPacketStreamingSignalCompression(const std::string& signalStringId, bool enabled);
+    void applyPacketStreamingSignalCompression(const SignalNumericIdType& signalNumericId, const std::string& signalStringId);
+
     void setTransportLayerPropsHandler(const OnTrasportLayerPropertiesCallback& transportLayerPropsHandler);
 
 private:
@@ -58,5 +71,6 @@ private:
     OnTrasportLayerPropertiesCallback transportLayerPropsHandler;
 
     packet_streaming::PacketStreamingServer packetStreamingServer;
+    std::unordered_map<std::string, bool> signalCompressionOverrides;
 };
 END_NAMESPACE_OPENDAQ_NATIVE_STREAMING_PROTOCOL
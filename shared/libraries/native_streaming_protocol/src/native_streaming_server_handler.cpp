@@ -6,6 +6,7 @@
 #include <config_protocol/config_protocol_server.h>
 
 #include <opendaq/ids_parser.h>
+#include <algorithm>
 
 #include <coreobjects/property_object_factory.h>
 
@@ -135,6 +136,13 @@ bool NativeStreamingServerHandler::handleSignalSubscription(const SignalNumericI
               signalStringId, signalNumericId);
         try
         {
+            // Applied through the registry, so that it is serialized with the packets sent to the session
+            subscribersRegistry.sendToClient(session,
+                                             [signalNumericId, &signalStringId](std::shared_ptr<ServerSessionHandler>& sessionHandler)
+                                             {
+                                                 sessionHandler->applyPacketStreamingSignalCompression(signalNumericId, signalStringId);
+                                             });
+
             if (subscribersRegistry.registerSignalSubscriber(signalStringId, session))
             {
                 signalSubscribedHandler(findRegisteredSignal(signalStringId));
@@ -171,11 +179,14 @@ bool NativeStreamingServerHandler::handleSignalSubscription(const SignalNumericI
 void NativeStreamingServerHandler::sendPacket(const SignalPtr& signal, const PacketPtr& packet)
 {
     auto signalNumericId = findSignalNumericId(signal);
+
+    // The packet is encoded lazily, at most once for each encoding requested by the subscribed sessions
+    packet_streaming::SharedPacketEncoding encoding(signalNumericId, packet);
     subscribersRegistry.sendToSubscribers(
         signal,
-        [signalNumericId, &packet](std::shared_ptr<ServerSessionHandler>& sessionHandler)
+        [&encoding](std::shared_ptr<ServerSessionHandler>& sessionHandler)
         {
-            sessionHandler->sendPacket(signalNumericId, packet);
+            sessionHandler->sendEncodedPacket(encoding);
         });
 }
 
@@ -194,6 +205,41 @@ void NativeStreamingServerHandler::releaseSessionHandler(SessionPtr session)
 void NativeStreamingServerHandler::handleTransportLayerProps(const PropertyObjectPtr& propertyObject,
                                                                    std::shared_ptr<ServerSessionHandler> sessionHandler)
 {
+    // clients advertise the highest packet streaming version they can decode, older clients do not send it
+    if (propertyObject.hasProperty("PacketStreamingVersion") &&
+        propertyObject.getProperty("PacketStreamingVersion").getValueType() == ctInt)
+    {
+        Int clientVersion = propertyObject.getPropertyValue("PacketStreamingVersion");
+        const auto version = static_cast<uint8_t>(std::clamp<Int>(clientVersion, 0, PACKET_STREAMING_LATEST_VERSION));
+        LOG_I("Packet streaming version {}", version);
+        sessionHandler->setPacketStreamingVersion(version);
+    }
+
+    if (propertyObject.hasProperty("PacketStreamingCompression") &&
+        propertyObject.getProperty("PacketStreamingCompression").getValueType() == ctBool)
+    {
+        Bool compressionEnabled = propertyObject.getPropertyValue("PacketStreamingCompression");
+        LOG_I("Packet streaming compression {}", compressionEnabled ? "enabled" : "disabled");
+        sessionHandler->setPacketStreamingCompression(compressionEnabled);
+    }
+
+    // overrides of the session compression setting for individual signals, by signal string ID
+    if (propertyObject.hasProperty("PacketStreamingSignalCompression") &&
+        propertyObject.getProperty("PacketStreamingSignalCompression").getValueType() == ctDict)
+    {
+        DictPtr<IString, IBaseObject> signalCompression = propertyObject.getPropertyValue("PacketStreamingSignalCompression");
+        for (const auto& [signalStringId, value] : signalCompression)
+        {
+            if (value.getCoreType() != ctBool)
+                continue;
+
+            const Bool compressionEnabled = value;
+            const auto signalId = signalStringId.toStdString();
+            LOG_I("Packet streaming compression {} for signal {}", compressionEnabled ? "enabled" : "disabled", signalId);
+            sessionHandler->setPacketStreamingSignalCompression(signalId, compressionEnabled);
+        }
+    }
+
     if (propertyObject.hasProperty("HeartbeatEnabled") &&
         propertyObject.hasProperty("HeartbeatPeriod") &&
         propertyObject.hasProperty("HeartbeatTimeout") &&
@@ -95,6 +95,15 @@ void ServerSessionHandler::sendPacket(const SignalNumericIdType signalId, const
     }
 }
 
+void ServerSessionHandler::sendEncodedPacket(packet_streaming::SharedPacketEncoding& encoding)
+{
+    packetStreamingServer.addEncodedDaqPacket(encoding);
+    while (const auto packetBuffer = packetStreamingServer.getNextPacketBuffer())
+    {
+        sendPacketBuffer(packetBuffer);
+    }
+}
+
 void ServerSessionHandler::sendSubscribingDone(const SignalNumericIdType signalNumericId)
 {
     std::vector<WriteTask> tasks;
@@ -244,6 +253,36 @@ ReadTask ServerSessionHandler::readTransportLayerProperties(const void* data, si
     return createReadHeaderTask();
 }
 
+void ServerSessionHandler::setPacketStreamingVersion(uint8_t version)
+{
+    packetStreamingServer.setVersion(version);
+}
+
+void ServerSessionHandler::setPacketStreamingCompression(bool enabled)
+{
+    packetStreamingServer.setCompressionEnabled(enabled);
+}
+
+bool ServerSessionHandler::isPacketStreamingCompressionEnabled() const
+{
+    return packetStreamingServer.isCompressionEnabled();
+}
+
+void ServerSessionHandler::setPacketStreamingSignalCompression(const std::string& signalStringId, bool enabled)
+{
+    signalCompressionOverrides[signalStringId] = enabled;
+}
+
+void ServerSessionHandler::applyPacketStreamingSignalCompression(const SignalNumericIdType& signalNumericId,
+                                                                 const std::string& signalStringId)
+{
+    const auto it = signalCompressionOverrides.find(signalStringId);
+    if (it != signalCompressionOverrides.end())
+        packetStreamingServer.setSignalCompressionEnabled(signalNumericId, it->second);
+    else
+        packetStreamingServer.setSignalCompressionEnabled(signalNumericId, std::nullopt);
+}
+
 void ServerSessionHandler::setTransportLayerPropsHandler(const OnTrasportLayerPropertiesCallback& transportLayerPropsHandler)
 {
     this->transportLayerPropsHandler = transportLayerPropsHandler;
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2022-2023 Blueberry d.o.o.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <opendaq/data_descriptor_ptr.h>
+#include <opendaq/sample_type.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace daq::packet_streaming
+{
+
+// Lossless codecs for data packet payloads. Values are split into blocks of PACKET_COMPRESSION_BLOCK_SIZE;
+// each block stores a shift and a bit width followed by the bit-packed per-value residuals.
+enum class PacketCompressionCodec : uint8_t
+{
+    none = 0,
+    intDelta,  // delta to previous value, zigzag encoded
+    floatXor   // XOR with previous value bits
+};
+
+#define PACKET_COMPRESSION_BLOCK_SIZE 128
+
+class PacketCompression
+{
+public:
+    static PacketCompressionCodec getCodec(SampleType sampleType);
+
+    // sample type of the raw data packet buffer, i.e. the input sample type of post scaling if set
+    static SampleType getPayloadSampleType(const DataDescriptorPtr& descriptor);
+
+    // upper bound of compressed size; compressed data is never larger than the raw data plus block headers
+    static size_t getMaxCompressedSize(size_t valueCount, size_t valueSize);
+
+    // returns size of compressed data written to `dst`
+    static size_t compress(SampleType sampleType, const void* src, size_t valueCount, uint8_t* dst);
+
+    static void decompress(SampleType sampleType, const uint8_t* src, size_t srcSize, void* dst, size_t valueCount);
+};
+
+}
@@ -29,9 +29,19 @@ enum PacketType: uint8_t { event = 0, data, release, alreadySent };
 
 #define PACKET_FLAG_CAN_RELEASE            0x1
 #define PACKET_FLAG_OFFSET_TYPE_MASK       (0x2 | 0x4)
+#define PACKET_FLAG_COMPRESSED             0x8
 
 #define PACKET_FLAG_OFFSET_TYPE_SHIFT      1
 
+// version 0: all event packets are JSON serialized
+// version 1: data descriptor changed event packets are binary encoded and reference cached descriptors
+#define PACKET_STREAMING_VERSION_JSON_EVENTS    0
+#define PACKET_STREAMING_VERSION_BINARY_EVENTS  1
+#define PACKET_STREAMING_LATEST_VERSION         PACKET_STREAMING_VERSION_BINARY_EVENTS
+
+#define PACKET_STREAMING_DESCRIPTOR_CACHE_SIZE  64
+#define PACKET_STREAMING_NO_DESCRIPTOR_ID       0
+
 struct GenericPacketHeader
 {
     uint8_t size;
@@ -63,6 +73,22 @@ struct AlreadySentPacketHeader
     Int domainPacketId;
 };
 
+// payload of binary encoded data descriptor changed event packet, followed by `definitionCount` descriptor definitions;
+// descriptor IDs are 1-based indices into the descriptor cache shared by server and client
+struct DescriptorChangedEventPayload
+{
+    uint32_t valueDescriptorId;
+    uint32_t domainDescriptorId;
+    uint32_t definitionCount;
+};
+
+// header of descriptor definition, followed by zero-terminated JSON serialized descriptor of `size` bytes
+struct DescriptorDefinitionHeader
+{
+    uint32_t descriptorId;
+    uint32_t size;
+};
+
 struct PacketBuffer
 {
     PacketBuffer(const PacketBuffer&) = delete;
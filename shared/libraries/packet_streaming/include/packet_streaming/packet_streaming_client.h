@@ -49,6 +49,7 @@ private:
     std::queue<std::tuple<uint32_t, PacketPtr>> queue;
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
     std::unordered_map<uint32_t, DataDescriptorPtr> domainDescriptors;
+    std::vector<DataDescriptorPtr> descriptorCache;
 
     std::unordered_map<Int, DataPacketPtr> referencedPackets;
     std::unordered_map<Int, PacketBufferPtr> referencedPacketBuffers;
@@ -57,6 +58,12 @@ private:
     mutable std::mutex descriptorsSync;
 
     void addEventPacketBuffer(const PacketBufferPtr& packetBuffer);
+    EventPacketPtr decodeBinaryDescriptorChangedPacket(const PacketBufferPtr& packetBuffer, bool& definesDescriptors);
+    DataDescriptorPtr getCachedDescriptor(uint32_t descriptorId) const;
+    bool isDescriptorChanged(uint32_t signalId,
+                             const DataDescriptorPtr& valueDescriptor,
+                             const DataDescriptorPtr& domainDescriptor,
+                             bool compareByValue) const;
     DataPacketPtr addDataPacketBuffer(const PacketBufferPtr& packetBuffer, const DataPacketPtr& domainPacket);
     void addReleasePacketBuffer(const PacketBufferPtr& packetBuffer);
     void addAlreadySentPacketBuffer(const PacketBufferPtr& packetBuffer);
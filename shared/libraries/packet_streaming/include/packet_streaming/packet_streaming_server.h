@@ -20,6 +20,8 @@
 #include <opendaq/data_packet_ptr.h>
 #include <opendaq/event_packet_ptr.h>
 #include <queue>
+#include <atomic>
+#include <optional>
 
 namespace daq::packet_streaming
 {
@@ -35,13 +37,76 @@ using PacketCollectionPtr = std::shared_ptr<PacketCollection>;
     
 enum class ReleaseAction { markForRelease, subscribe, alreadySent };
 
+// Lazily encoded forms of a single packet, shared by all servers the packet is sent to. Each form - the data packet
+// with or without compression, the JSON encoded event, or the serialized descriptors and binary encoding of a
+// descriptor changed event - is produced at most once, and only if one of the servers needs it. Not thread-safe.
+class SharedPacketEncoding
+{
+public:
+    SharedPacketEncoding(uint32_t signalId, PacketPtr packet, SerializerPtr jsonSerializer = nullptr);
+
+    uint32_t getSignalId() const;
+    const PacketPtr& getPacket() const;
+
+    // Compresses the payload if `compressionBuffer` is set; it is used as scratch space and can be reused across calls
+    PacketBufferPtr getDataPacketBuffer(std::vector<uint8_t>* compressionBuffer);
+    PacketBufferPtr getJsonEventPacketBuffer();
+
+    // JSON serialized value or domain descriptor of a descriptor changed event
+    const std::string& getDescriptorDefinition(bool domain);
+    PacketBufferPtr getBinaryDescriptorChangedPacketBuffer(uint32_t valueDescriptorId,
+                                                           uint32_t domainDescriptorId,
+                                                           bool defineValue,
+                                                           bool defineDomain);
+
+private:
+    struct BinaryEncoding
+    {
+        uint32_t valueDescriptorId;
+        uint32_t domainDescriptorId;
+        bool defineValue;
+        bool defineDomain;
+        PacketBufferPtr packetBuffer;
+    };
+
+    uint32_t signalId;
+    PacketPtr packet;
+    SerializerPtr jsonSerializer;
+    PacketBufferPtr dataPacketBuffers[2];
+    PacketBufferPtr jsonEventPacketBuffer;
+    std::optional<std::string> descriptorDefinitions[2];
+    std::vector<BinaryEncoding> binaryEncodings;
+
+    const SerializerPtr& getSerializer();
+};
+
 class PacketStreamingServer
 {
 public:
     PacketStreamingServer(size_t releaseThreshold = 1);
 
+    // Selects the encoding of outgoing packets; must not be higher than the version supported by the client
+    void setVersion(uint8_t version);
+    uint8_t getVersion() const;
+
+    // Enables lossless compression of data packet payloads of numeric sample types
+    void setCompressionEnabled(bool enabled);
+    bool isCompressionEnabled() const;
+
+    // Overrides compression for a single signal; `std::nullopt` reverts the signal to the server-wide setting.
+    // Not thread-safe with respect to adding packets.
+    void setSignalCompressionEnabled(const uint32_t signalId, std::optional<bool> enabled);
+    bool isCompressionEnabled(const uint32_t signalId) const;
+
     void addDaqPacket(const uint32_t signalId, const PacketPtr& packet);
     void addDaqPacket(const uint32_t signalId, PacketPtr&& packet);
+
+    // Queues the form of the shared packet encoding that matches the version and compression of this server, or an
+    // "already sent" notification instead if this client has already received the data packet through another signal.
+    // The same encoding can be passed to any number of servers, so that each packet is encoded only once regardless
+    // of how many clients it is sent to.
+    void addEncodedDaqPacket(SharedPacketEncoding& encoding);
+
     PacketBufferPtr getNextPacketBuffer();
 
     void checkAndSendReleasePacket(bool force);
@@ -53,8 +118,36 @@ private:
     std::unordered_map<uint32_t, DataDescriptorPtr> dataDescriptors;
     PacketCollectionPtr packetCollection;
     size_t releaseThreshold;
+    std::atomic<uint8_t> version;
+    std::atomic<bool> compressionEnabled;
+    std::unordered_map<uint32_t, bool> signalCompressionEnabled;
+    // Descriptors known by the client, by slot, and the slot of each by its serialized form
+    std::vector<DataDescriptorPtr> descriptorCache;
+    std::vector<std::string> descriptorCacheDefinitions;
+    std::unordered_map<std::string, uint32_t> descriptorIdsByDefinition;
+    size_t nextDescriptorCacheSlot;
+
+    // Data payloads are compressed here before it is known whether compression pays off, so only packets that
+    // are sent compressed need an allocation, and only of the compressed size
+    std::vector<uint8_t> compressionBuffer;
+
+    void queueEventPacket(SharedPacketEncoding& encoding);
+    uint32_t getCachedDescriptorId(SharedPacketEncoding& encoding, bool domain, bool& define);
+    void storeDataDescriptor(const uint32_t signalId, const EventPacketPtr& packet);
+    void checkDataDescriptor(const uint32_t signalId) const;
 
-    void addEventPacket(const uint32_t signalId, const EventPacketPtr& packet);
+    friend class SharedPacketEncoding;
+    static PacketBufferPtr createEventPacketBuffer(const uint32_t signalId, const EventPacketPtr& packet, const SerializerPtr& serializer);
+    static PacketBufferPtr createBinaryDescriptorChangedPacketBuffer(const uint32_t signalId,
+                                                                     const DescriptorChangedEventPayload& payloadHeader,
+                                                                     const std::vector<std::pair<uint32_t, const std::string*>>& definitions);
+    static PacketBufferPtr createDataPacketBuffer(const uint32_t signalId,
+                                                  const DataPacketPtr& packet,
+                                                  bool canRelease,
+                                                  std::vector<uint8_t>* compressionBuffer);
+    static PacketBufferPtr createCompressedDataPacketBuffer(DataPacketHeader* packetHeader,
+                                                            const DataPacketPtr& packet,
+                                                            std::vector<uint8_t>& compressionBuffer);
     template <bool CheckRefCount>
     static bool canReleasePacket(const DataPacketPtr& packet);
     bool shouldSendPacket(const DataPacketPtr& packet, Int packetId, bool markForRelease) const;
@@ -0,0 +1,347 @@
+#include <packet_streaming/packet_compression.h>
+#include <packet_streaming/packet_streaming.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+namespace daq::packet_streaming
+{
+
+namespace
+{
+
+uint64_t zigzagEncode(uint64_t value)
+{
+    return (value << 1) ^ static_cast<uint64_t>(static_cast<int64_t>(value) >> 63);
+}
+
+uint64_t zigzagDecode(uint64_t value)
+{
+    return (value >> 1) ^ (~(value & 1) + 1);
+}
+
+uint8_t countTrailingZeros(uint64_t value)
+{
+    uint8_t count = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+}
+
+uint8_t getBitWidth(uint64_t value)
+{
+    uint8_t width = 0;
+    while (value)
+    {
+        value >>= 1;
+        ++width;
+    }
+    return width;
+}
+
+template <typename T>
+uint64_t toBits(T value)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t> bits;
+        std::memcpy(&bits, &value, sizeof(T));
+        return bits;
+    }
+    else
+    {
+        return static_cast<uint64_t>(static_cast<int64_t>(value));
+    }
+}
+
+template <typename T>
+T fromBits(uint64_t bits)
+{
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t> narrowBits = static_cast<decltype(narrowBits)>(bits);
+        T value;
+        std::memcpy(&value, &narrowBits, sizeof(T));
+        return value;
+    }
+    else
+    {
+        return static_cast<T>(bits);
+    }
+}
+
+// little-endian bit stream; writes exactly ceil(totalBits / 8) bytes
+class BitWriter
+{
+public:
+    explicit BitWriter(uint8_t* dst)
+        : dst(dst)
+        , accumulator(0)
+        , bitCount(0)
+    {
+    }
+
+    void write(uint64_t value, uint8_t width)
+    {
+        if (width == 0)
+            return;
+
+        accumulator |= value << bitCount;
+        if (bitCount + width >= 64)
+        {
+            flushBytes(8);
+            accumulator = bitCount ? value >> (64 - bitCount) : 0;
+            bitCount = static_cast<uint8_t>(bitCount + width - 64);
+        }
+        else
+        {
+            bitCount = static_cast<uint8_t>(bitCount + width);
+        }
+    }
+
+    uint8_t* finish()
+    {
+        flushBytes((bitCount + 7) / 8);
+        accumulator = 0;
+        bitCount = 0;
+        return dst;
+    }
+
+private:
+    void flushBytes(size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            *dst++ = static_cast<uint8_t>(accumulator >> (8 * i));
+    }
+
+    uint8_t* dst;
+    uint64_t accumulator;
+    uint8_t bitCount;
+};
+
+class BitReader
+{
+public:
+    BitReader(const uint8_t* src, const uint8_t* end)
+        : src(src)
+        , end(end)
+        , accumulator(0)
+        , bitCount(0)
+    {
+    }
+
+    uint64_t read(uint8_t width)
+    {
+        uint64_t value = 0;
+        uint8_t readBits = 0;
+        while (readBits < width)
+        {
+            if (bitCount == 0)
+            {
+                if (src == end)
+                    throw PacketStreamingException("Compressed payload truncated");
+                accumulator = *src++;
+                bitCount = 8;
+            }
+
+            const uint8_t take = std::min<uint8_t>(bitCount, width - readBits);
+            const uint64_t mask = (uint64_t(1) << take) - 1;
+            value |= (accumulator & mask) << readBits;
+            accumulator >>= take;
+            bitCount -= take;
+            readBits += take;
+        }
+        return value;
+    }
+
+    // skips the padding bits of the current block
+    const uint8_t* finish()
+    {
+        bitCount = 0;
+        return src;
+    }
+
+    void reset(const uint8_t* position)
+    {
+        src = position;
+        bitCount = 0;
+    }
+
+private:
+    const uint8_t* src;
+    const uint8_t* end;
+    uint64_t accumulator;
+    uint8_t bitCount;
+};
+
+template <typename T, PacketCompressionCodec Codec>
+size_t compressValues(const T* src, size_t valueCount, uint8_t* dst)
+{
+    uint8_t* out = dst;
+    uint64_t residuals[PACKET_COMPRESSION_BLOCK_SIZE];
+    uint64_t previous = 0;
+
+    for (size_t blockStart = 0; blockStart < valueCount; blockStart += PACKET_COMPRESSION_BLOCK_SIZE)
+    {
+        const size_t blockSize = std::min<size_t>(PACKET_COMPRESSION_BLOCK_SIZE, valueCount - blockStart);
+
+        uint64_t combined = 0;
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+            const uint64_t current = toBits(src[blockStart + i]);
+            if constexpr (Codec == PacketCompressionCodec::intDelta)
+                residuals[i] = zigzagEncode(current - previous);
+            else
+                residuals[i] = current ^ previous;
+            previous = current;
+            combined |= residuals[i];
+        }
+
+        const uint8_t shift = combined ? countTrailingZeros(combined) : 0;
+        const uint8_t width = getBitWidth(combined >> shift);
+        *out++ = shift;
+        *out++ = width;
+
+        BitWriter writer(out);
+        for (size_t i = 0; i < blockSize; ++i)
+            writer.write(residuals[i] >> shift, width);
+        out = writer.finish();
+    }
+
+    return static_cast<size_t>(out - dst);
+}
+
+template <typename T, PacketCompressionCodec Codec>
+void decompressValues(const uint8_t* src, size_t srcSize, T* dst, size_t valueCount)
+{
+    const uint8_t* end = src + srcSize;
+    BitReader reader(src, end);
+    uint64_t previous = 0;
+
+    for (size_t blockStart = 0; blockStart < valueCount; blockStart += PACKET_COMPRESSION_BLOCK_SIZE)
+    {
+        const size_t blockSize = std::min<size_t>(PACKET_COMPRESSION_BLOCK_SIZE, valueCount - blockStart);
+
+        if (end - src < 2)
+            throw PacketStreamingException("Compressed payload truncated");
+        const uint8_t shift = *src++;
+        const uint8_t width = *src++;
+        if (width > 64 || shift + width > 64)
+            throw PacketStreamingException("Invalid compressed block");
+
+        reader.reset(src);
+        for (size_t i = 0; i < blockSize; ++i)
+        {
+            const uint64_t residual = reader.read(width) << shift;
+            uint64_t current;
+            if constexpr (Codec == PacketCompressionCodec::intDelta)
+                current = previous + zigzagDecode(residual);
+            else
+                current = previous ^ residual;
+            dst[blockStart + i] = fromBits<T>(current);
+            previous = current;
+        }
+        src = reader.finish();
+    }
+}
+
+template <template <typename, PacketCompressionCodec> class Operation, typename... Args>
+auto dispatch(SampleType sampleType, Args&&... args)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+            return Operation<float, PacketCompressionCodec::floatXor>::run(std::forward<Args>(args)...);
+        case SampleType::Float64:
+            return Operation<double, PacketCompressionCodec::floatXor>::run(std::forward<Args>(args)...);
+        case SampleType::UInt8:
+            return Operation<uint8_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::Int8:
+            return Operation<int8_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::UInt16:
+            return Operation<uint16_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::Int16:
+            return Operation<int16_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::UInt32:
+            return Operation<uint32_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::Int32:
+            return Operation<int32_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::UInt64:
+            return Operation<uint64_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        case SampleType::Int64:
+            return Operation<int64_t, PacketCompressionCodec::intDelta>::run(std::forward<Args>(args)...);
+        default:
+            throw PacketStreamingException("Sample type not supported for compression");
+    }
+}
+
+template <typename T, PacketCompressionCodec Codec>
+struct Compress
+{
+    static size_t run(const void* src, size_t valueCount, uint8_t* dst)
+    {
+        return compressValues<T, Codec>(static_cast<const T*>(src), valueCount, dst);
+    }
+};
+
+template <typename T, PacketCompressionCodec Codec>
+struct Decompress
+{
+    static void run(const uint8_t* src, size_t srcSize, void* dst, size_t valueCount)
+    {
+        decompressValues<T, Codec>(src, srcSize, static_cast<T*>(dst), valueCount);
+    }
+};
+
+}
+
+PacketCompressionCodec PacketCompression::getCodec(SampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case SampleType::Float32:
+        case SampleType::Float64:
+            return PacketCompressionCodec::floatXor;
+        case SampleType::UInt8:
+        case SampleType::Int8:
+        case SampleType::UInt16:
+        case SampleType::Int16:
+        case SampleType::UInt32:
+        case SampleType::Int32:
+        case SampleType::UInt64:
+        case SampleType::Int64:
+            return PacketCompressionCodec::intDelta;
+        default:
+            return PacketCompressionCodec::none;
+    }
+}
+
+SampleType PacketCompression::getPayloadSampleType(const DataDescriptorPtr& descriptor)
+{
+    const auto postScaling = descriptor.getPostScaling();
+    if (postScaling.assigned())
+        return postScaling.getInputSampleType();
+    return descriptor.getSampleType();
+}
+
+size_t PacketCompression::getMaxCompressedSize(size_t valueCount, size_t valueSize)
+{
+    // a residual is at most one byte wider than the value (zigzag encoded delta), and never wider than 64 bits
+    const size_t blockCount = (valueCount + PACKET_COMPRESSION_BLOCK_SIZE - 1) / PACKET_COMPRESSION_BLOCK_SIZE;
+    return blockCount * 2 + valueCount * std::min<size_t>(valueSize + 1, 8);
+}
+
+size_t PacketCompression::compress(SampleType sampleType, const void* src, size_t valueCount, uint8_t* dst)
+{
+    return dispatch<Compress>(sampleType, src, valueCount, dst);
+}
+
+void PacketCompression::decompress(SampleType sampleType, const uint8_t* src, size_t srcSize, void* dst, size_t valueCount)
+{
+    dispatch<Decompress>(sampleType, src, srcSize, dst, valueCount);
+}
+
+}
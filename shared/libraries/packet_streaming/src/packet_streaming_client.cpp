@@ -1,14 +1,18 @@
 #include <packet_streaming/packet_streaming_client.h>
+#include <packet_streaming/packet_compression.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/event_packet_params.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/deleter_factory.h>
+#include <opendaq/sample_type_traits.h>
+#include <cstring>
 
 namespace daq::packet_streaming
 {
 
 PacketStreamingClient::PacketStreamingClient()
     : jsonDeserializer(JsonDeserializer())
+    , descriptorCache(PACKET_STREAMING_DESCRIPTOR_CACHE_SIZE)
 {
 }
 
@@ -68,15 +72,36 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
     bool forwardPacket = true;
     auto signalId = packetBuffer->packetHeader->signalId;
 
-    const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
-
-    EventPacketPtr packet = jsonDeserializer.deserialize(eventPayloadString);
+    EventPacketPtr packet;
+    bool definesDescriptors = false;
+    if (packetBuffer->packetHeader->version >= PACKET_STREAMING_VERSION_BINARY_EVENTS)
+    {
+        packet = decodeBinaryDescriptorChangedPacket(packetBuffer, definesDescriptors);
+    }
+    else
+    {
+        const auto eventPayloadString = String((ConstCharPtr) packetBuffer->payload);
+        packet = jsonDeserializer.deserialize(eventPayloadString);
+    }
 
     if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
     {
         // drop packet if signal descriptors have not been changed
-        if (BaseObjectPtr::Equals(packet, getDataDescriptorChangedEventPacket(signalId)))
+        if (packetBuffer->packetHeader->version >= PACKET_STREAMING_VERSION_BINARY_EVENTS)
+        {
+            // referenced descriptors are shared cache objects, so identity comparison is sufficient for them; a
+            // descriptor evicted from the cache and defined again is a new object and is compared by value
+            const auto params = packet.getParameters();
+            if (!isDescriptorChanged(signalId,
+                                     params.get(event_packet_param::DATA_DESCRIPTOR),
+                                     params.get(event_packet_param::DOMAIN_DATA_DESCRIPTOR),
+                                     definesDescriptors))
+                forwardPacket = false;
+        }
+        else if (BaseObjectPtr::Equals(packet, getDataDescriptorChangedEventPacket(signalId)))
+        {
             forwardPacket = false;
+        }
 
         std::scoped_lock lock(descriptorsSync);
         if (packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR).assigned())
@@ -93,6 +118,80 @@ void PacketStreamingClient::addEventPacketBuffer(const PacketBufferPtr& packetBu
         queue.push({signalId, packet});
 }
 
+EventPacketPtr PacketStreamingClient::decodeBinaryDescriptorChangedPacket(const PacketBufferPtr& packetBuffer, bool& definesDescriptors)
+{
+    const auto payloadSize = static_cast<size_t>(packetBuffer->packetHeader->payloadSize);
+    if (payloadSize < sizeof(DescriptorChangedEventPayload))
+        throw PacketStreamingException("Invalid descriptor changed event packet");
+
+    auto src = static_cast<const uint8_t*>(packetBuffer->payload);
+    const auto end = src + payloadSize;
+
+    DescriptorChangedEventPayload payloadHeader;
+    std::memcpy(&payloadHeader, src, sizeof(DescriptorChangedEventPayload));
+    src += sizeof(DescriptorChangedEventPayload);
+
+    definesDescriptors = payloadHeader.definitionCount > 0;
+    for (uint32_t i = 0; i < payloadHeader.definitionCount; ++i)
+    {
+        if (static_cast<size_t>(end - src) < sizeof(DescriptorDefinitionHeader))
+            throw PacketStreamingException("Invalid descriptor definition");
+
+        DescriptorDefinitionHeader definitionHeader;
+        std::memcpy(&definitionHeader, src, sizeof(DescriptorDefinitionHeader));
+        src += sizeof(DescriptorDefinitionHeader);
+
+        if (definitionHeader.descriptorId == PACKET_STREAMING_NO_DESCRIPTOR_ID ||
+            definitionHeader.descriptorId > descriptorCache.size() ||
+            definitionHeader.size == 0 ||
+            static_cast<size_t>(end - src) < definitionHeader.size)
+            throw PacketStreamingException("Invalid descriptor definition");
+
+        const auto serializedDescriptor = String(reinterpret_cast<ConstCharPtr>(src), definitionHeader.size - 1);
+        descriptorCache[definitionHeader.descriptorId - 1] = jsonDeserializer.deserialize(serializedDescriptor);
+        src += definitionHeader.size;
+    }
+
+    return DataDescriptorChangedEventPacket(getCachedDescriptor(payloadHeader.valueDescriptorId),
+                                            getCachedDescriptor(payloadHeader.domainDescriptorId));
+}
+
+DataDescriptorPtr PacketStreamingClient::getCachedDescriptor(uint32_t descriptorId) const
+{
+    if (descriptorId == PACKET_STREAMING_NO_DESCRIPTOR_ID)
+        return nullptr;
+
+    if (descriptorId > descriptorCache.size() || !descriptorCache[descriptorId - 1].assigned())
+        throw PacketStreamingException("Descriptor not cached");
+
+    return descriptorCache[descriptorId - 1];
+}
+
+bool PacketStreamingClient::isDescriptorChanged(uint32_t signalId,
+                                                const DataDescriptorPtr& valueDescriptor,
+                                                const DataDescriptorPtr& domainDescriptor,
+                                                bool compareByValue) const
+{
+    std::scoped_lock lock(descriptorsSync);
+
+    const auto isChanged = [compareByValue](const std::unordered_map<uint32_t, DataDescriptorPtr>& descriptors,
+                                            uint32_t signalId,
+                                            const DataDescriptorPtr& descriptor)
+    {
+        DataDescriptorPtr current;
+        if (const auto it = descriptors.find(signalId); it != descriptors.end())
+            current = it->second;
+
+        if (descriptor.getObject() == current.getObject())
+            return false;
+        if (!compareByValue || !descriptor.assigned() || !current.assigned())
+            return true;
+        return !BaseObjectPtr::Equals(descriptor, current);
+    };
+
+    return isChanged(dataDescriptors, signalId, valueDescriptor) || isChanged(domainDescriptors, signalId, domainDescriptor);
+}
+
 DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr& packetBuffer, const DataPacketPtr& domainPacket)
 {
     const auto dataPacketHeader = reinterpret_cast<DataPacketHeader*>(packetBuffer->packetHeader);
@@ -148,6 +247,33 @@ DataPacketPtr PacketStreamingClient::addDataPacketBuffer(const PacketBufferPtr&
         packet = DataPacketWithDomain(domPacket, valueDescriptor, dataPacketHeader->sampleCount, offset);
         assert(packet.getRawData() == nullptr);
     }
+    else if (dataPacketHeader->genericHeader.flags & PACKET_FLAG_COMPRESSED)
+    {
+        // decompress straight into the memory owned by the packet
+        const auto sampleType = PacketCompression::getPayloadSampleType(valueDescriptor);
+        const auto rawDataSize = static_cast<size_t>(dataPacketHeader->sampleCount) * valueDescriptor.getRawSampleSize();
+        const auto data = std::malloc(rawDataSize);
+        try
+        {
+            PacketCompression::decompress(sampleType,
+                                          static_cast<const uint8_t*>(packetBuffer->payload),
+                                          dataPacketHeader->genericHeader.payloadSize,
+                                          data,
+                                          rawDataSize / getSampleSize(sampleType));
+        }
+        catch (...)
+        {
+            std::free(data);
+            throw;
+        }
+
+        packet = DataPacketWithExternalMemory(domPacket,
+                                              valueDescriptor,
+                                              dataPacketHeader->sampleCount,
+                                              data,
+                                              Deleter([](void* address) { std::free(address); }),
+                                              offset);
+    }
     else
     {
         packet = DataPacketWithExternalMemory(domPacket,
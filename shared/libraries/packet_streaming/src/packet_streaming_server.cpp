@@ -1,7 +1,10 @@
 #include <packet_streaming/packet_streaming_server.h>
+#include <packet_streaming/packet_compression.h>
 #include <opendaq/event_packet_ids.h>
 #include <opendaq/packet_destruct_callback_factory.h>
 #include <opendaq/event_packet_params.h>
+#include <opendaq/sample_type_traits.h>
+#include <cstring>
 
 namespace daq::packet_streaming
 {
@@ -10,15 +13,35 @@ PacketStreamingServer::PacketStreamingServer(size_t releaseThreshold)
     : jsonSerializer(JsonSerializer())
     , packetCollection(std::make_shared<PacketCollection>())
     , releaseThreshold(releaseThreshold)
+    , version(PACKET_STREAMING_VERSION_JSON_EVENTS)
+    , compressionEnabled(false)
+    , descriptorCache(PACKET_STREAMING_DESCRIPTOR_CACHE_SIZE)
+    , descriptorCacheDefinitions(PACKET_STREAMING_DESCRIPTOR_CACHE_SIZE)
+    , nextDescriptorCacheSlot(0)
 {
 }
 
+void PacketStreamingServer::setVersion(uint8_t version)
+{
+    if (version > PACKET_STREAMING_LATEST_VERSION)
+        throw PacketStreamingException("Packet streaming version not supported");
+    this->version = version;
+}
+
+uint8_t PacketStreamingServer::getVersion() const
+{
+    return version;
+}
+
 void PacketStreamingServer::addDaqPacket(const uint32_t signalId, const PacketPtr& packet)
 {
     switch (packet.getType())
     {
         case daq::PacketType::Event:
-            addEventPacket(signalId, packet);
+            {
+                SharedPacketEncoding encoding(signalId, packet, jsonSerializer);
+                queueEventPacket(encoding);
+            }
             break;
         case daq::PacketType::Data:
             {
@@ -38,7 +61,10 @@ void PacketStreamingServer::addDaqPacket(const uint32_t signalId, PacketPtr&& pa
     switch (packet.getType())
     {
         case daq::PacketType::Event:
-            addEventPacket(signalId, packet);
+            {
+                SharedPacketEncoding encoding(signalId, packet, jsonSerializer);
+                queueEventPacket(encoding);
+            }
             break;
         case daq::PacketType::Data:
             addDataPacket(signalId, DataPacketPtr(std::move(packet)));
@@ -50,6 +76,62 @@ void PacketStreamingServer::addDaqPacket(const uint32_t signalId, PacketPtr&& pa
     checkAndSendReleasePacket(false);
 }
 
+void PacketStreamingServer::setCompressionEnabled(bool enabled)
+{
+    compressionEnabled = enabled;
+}
+
+bool PacketStreamingServer::isCompressionEnabled() const
+{
+    return compressionEnabled;
+}
+
+void PacketStreamingServer::setSignalCompressionEnabled(const uint32_t signalId, std::optional<bool> enabled)
+{
+    if (enabled.has_value())
+        signalCompressionEnabled[signalId] = enabled.value();
+    else
+        signalCompressionEnabled.erase(signalId);
+}
+
+bool PacketStreamingServer::isCompressionEnabled(const uint32_t signalId) const
+{
+    if (signalCompressionEnabled.empty())
+        return compressionEnabled;
+
+    const auto it = signalCompressionEnabled.find(signalId);
+    return it != signalCompressionEnabled.end() ? it->second : compressionEnabled.load();
+}
+
+void PacketStreamingServer::addEncodedDaqPacket(SharedPacketEncoding& encoding)
+{
+    const auto signalId = encoding.getSignalId();
+    const auto& packet = encoding.getPacket();
+
+    switch (packet.getType())
+    {
+        case daq::PacketType::Event:
+            queueEventPacket(encoding);
+            break;
+        case daq::PacketType::Data:
+            {
+                checkDataDescriptor(signalId);
+
+                const DataPacketPtr dataPacket = packet;
+                const auto packetId = dataPacket.getPacketId();
+                if (shouldSendPacket(dataPacket, packetId, false))
+                    queue.push(encoding.getDataPacketBuffer(isCompressionEnabled(signalId) ? &compressionBuffer : nullptr));
+                else
+                    addAlreadySentPacket(signalId, packetId, getDomainPacketId(dataPacket), false);
+            }
+            break;
+        default:
+            throw NotSupportedException("Packet type not supported");
+    }
+
+    checkAndSendReleasePacket(false);
+}
+
 PacketBufferPtr PacketStreamingServer::getNextPacketBuffer()
 {
     if (!queue.empty())
@@ -62,7 +144,126 @@ PacketBufferPtr PacketStreamingServer::getNextPacketBuffer()
     return nullptr;
 }
 
-void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventPacketPtr& packet)
+void PacketStreamingServer::queueEventPacket(SharedPacketEncoding& encoding)
+{
+    const EventPacketPtr packet = encoding.getPacket();
+
+    PacketBufferPtr packetBuffer;
+    if (version >= PACKET_STREAMING_VERSION_BINARY_EVENTS && packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED)
+    {
+        bool defineValue;
+        bool defineDomain;
+        const auto valueDescriptorId = getCachedDescriptorId(encoding, false, defineValue);
+        const auto domainDescriptorId = getCachedDescriptorId(encoding, true, defineDomain);
+        packetBuffer = encoding.getBinaryDescriptorChangedPacketBuffer(valueDescriptorId, domainDescriptorId, defineValue, defineDomain);
+    }
+    else
+    {
+        packetBuffer = encoding.getJsonEventPacketBuffer();
+    }
+
+    storeDataDescriptor(encoding.getSignalId(), packet);
+    queue.push(packetBuffer);
+}
+
+PacketBufferPtr PacketStreamingServer::createBinaryDescriptorChangedPacketBuffer(
+    const uint32_t signalId,
+    const DescriptorChangedEventPayload& payloadHeader,
+    const std::vector<std::pair<uint32_t, const std::string*>>& definitions)
+{
+    size_t payloadSize = sizeof(DescriptorChangedEventPayload);
+    for (const auto& [_, definition] : definitions)
+        payloadSize += sizeof(DescriptorDefinitionHeader) + definition->size() + 1;
+
+    auto payload = std::make_unique<uint8_t[]>(payloadSize);
+    auto dst = payload.get();
+    std::memcpy(dst, &payloadHeader, sizeof(DescriptorChangedEventPayload));
+    dst += sizeof(DescriptorChangedEventPayload);
+    for (const auto& [descriptorId, definition] : definitions)
+    {
+        DescriptorDefinitionHeader definitionHeader;
+        definitionHeader.descriptorId = descriptorId;
+        definitionHeader.size = static_cast<uint32_t>(definition->size() + 1);
+        std::memcpy(dst, &definitionHeader, sizeof(DescriptorDefinitionHeader));
+        dst += sizeof(DescriptorDefinitionHeader);
+        std::memcpy(dst, definition->c_str(), definitionHeader.size);
+        dst += definitionHeader.size;
+    }
+
+    const auto packetHeader = new GenericPacketHeader();
+    packetHeader->size = sizeof(GenericPacketHeader);
+    packetHeader->type = PacketType::event;
+    packetHeader->version = PACKET_STREAMING_VERSION_BINARY_EVENTS;
+    packetHeader->flags = 0;
+    packetHeader->signalId = signalId;
+    packetHeader->payloadSize = static_cast<uint32_t>(payloadSize);
+
+    const auto payloadPtr = payload.release();
+    return std::make_shared<PacketBuffer>(
+        packetHeader,
+        payloadPtr,
+        [packetHeader, payloadPtr]()
+        {
+            delete packetHeader;
+            delete[] payloadPtr;
+        });
+}
+
+uint32_t PacketStreamingServer::getCachedDescriptorId(SharedPacketEncoding& encoding, bool domain, bool& define)
+{
+    define = false;
+
+    const DataDescriptorPtr descriptor = EventPacketPtr(encoding.getPacket())
+                                             .getParameters()
+                                             .get(domain ? event_packet_param::DOMAIN_DATA_DESCRIPTOR : event_packet_param::DATA_DESCRIPTOR);
+    if (!descriptor.assigned())
+        return PACKET_STREAMING_NO_DESCRIPTOR_ID;
+
+    // descriptors are usually re-sent as the same object, so try the cheap identity check first
+    for (size_t i = 0; i < descriptorCache.size(); ++i)
+        if (descriptorCache[i].getObject() == descriptor.getObject())
+            return static_cast<uint32_t>(i + 1);
+
+    // equal descriptors have equal serialized forms; the serialization is shared by all servers the event is sent to
+    const auto& definition = encoding.getDescriptorDefinition(domain);
+    const auto it = descriptorIdsByDefinition.find(definition);
+    if (it != descriptorIdsByDefinition.end())
+        return it->second;
+
+    const auto slot = nextDescriptorCacheSlot;
+    nextDescriptorCacheSlot = (nextDescriptorCacheSlot + 1) % descriptorCache.size();
+    const auto descriptorId = static_cast<uint32_t>(slot + 1);
+
+    if (descriptorCache[slot].assigned())
+        descriptorIdsByDefinition.erase(descriptorCacheDefinitions[slot]);
+    descriptorCache[slot] = descriptor;
+    descriptorCacheDefinitions[slot] = definition;
+    descriptorIdsByDefinition.emplace(definition, descriptorId);
+
+    define = true;
+    return descriptorId;
+}
+
+void PacketStreamingServer::storeDataDescriptor(const uint32_t signalId, const EventPacketPtr& packet)
+{
+    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED &&
+        packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR).assigned())
+    {
+        dataDescriptors.insert_or_assign(
+            signalId,
+            packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR));
+    }
+}
+
+void PacketStreamingServer::checkDataDescriptor(const uint32_t signalId) const
+{
+    if (dataDescriptors.find(signalId) == dataDescriptors.end())
+        throw PacketStreamingException("No signal descriptor event received");
+}
+
+PacketBufferPtr PacketStreamingServer::createEventPacketBuffer(const uint32_t signalId,
+                                                               const EventPacketPtr& packet,
+                                                               const SerializerPtr& serializer)
 {
     const auto packetHeader = new GenericPacketHeader();
     packetHeader->size = sizeof(GenericPacketHeader);
@@ -71,9 +272,9 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
     packetHeader->flags = 0;
     packetHeader->signalId = signalId;
 
-    jsonSerializer.reset();
-    packet.serialize(jsonSerializer);
-    auto serializedPacket = jsonSerializer.getOutput();
+    serializer.reset();
+    packet.serialize(serializer);
+    auto serializedPacket = serializer.getOutput();
 
     packetHeader->payloadSize = static_cast<uint32_t>(serializedPacket.getLength() + 1);
 
@@ -85,15 +286,7 @@ void PacketStreamingServer::addEventPacket(const uint32_t signalId, const EventP
                 serializedPacket.release();
         });
 
-    if (packet.getEventId() == event_packet_id::DATA_DESCRIPTOR_CHANGED &&
-        packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR).assigned())
-    {
-        dataDescriptors.insert_or_assign(
-            signalId,
-            packet.getParameters().get(event_packet_param::DATA_DESCRIPTOR));
-    }
-
-    queue.push(packetBuffer);
+    return packetBuffer;
 }
 
 template <bool CheckRefCount>
@@ -171,8 +364,7 @@ Int PacketStreamingServer::getDomainPacketId(const DataPacketPtr& packet)
 template <class DataPacket>
 void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&& packet)
 {
-    if (dataDescriptors.find(signalId) == dataDescriptors.end())
-        throw PacketStreamingException("No signal descriptor event received");
+    checkDataDescriptor(signalId);
 
     constexpr bool isPacketRValue = std::is_rvalue_reference_v<DataPacket&&>;
     const bool markPacketForRelease = canReleasePacket<isPacketRValue>(packet);
@@ -187,14 +379,28 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
         return;
     }
 
+    const auto packetBuffer =
+        createDataPacketBuffer(signalId, packet, markPacketForRelease, isCompressionEnabled(signalId) ? &compressionBuffer : nullptr);
+
+    if constexpr (isPacketRValue)
+        packet.release();
+
+    queue.push(packetBuffer);
+}
+
+PacketBufferPtr PacketStreamingServer::createDataPacketBuffer(const uint32_t signalId,
+                                                              const DataPacketPtr& packet,
+                                                              bool canRelease,
+                                                              std::vector<uint8_t>* compressionBuffer)
+{
     const auto packetHeader = static_cast<DataPacketHeader*>(std::malloc(sizeof(DataPacketHeader)));
     packetHeader->genericHeader.size = sizeof(DataPacketHeader);
     packetHeader->genericHeader.type = PacketType::data;
     packetHeader->genericHeader.version = 0;
-    packetHeader->genericHeader.flags = markPacketForRelease ? PACKET_FLAG_CAN_RELEASE : 0;
+    packetHeader->genericHeader.flags = canRelease ? PACKET_FLAG_CAN_RELEASE : 0;
     packetHeader->genericHeader.signalId = signalId;
-    packetHeader->packetId = packetId;
-    packetHeader->domainPacketId = domainPacketId;
+    packetHeader->packetId = packet.getPacketId();
+    packetHeader->domainPacketId = getDomainPacketId(packet);
     packetHeader->sampleCount = static_cast<Int>(packet.getSampleCount());
 
     setOffset(packet, packetHeader);
@@ -203,6 +409,12 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
     const auto packetDataSize = packetDataPtr != nullptr ? packet.getRawDataSize() : 0;
     packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(packetDataSize);
 
+    if (compressionBuffer != nullptr && packetDataPtr != nullptr)
+    {
+        if (auto compressedPacketBuffer = createCompressedDataPacketBuffer(packetHeader, packet, *compressionBuffer))
+            return compressedPacketBuffer;
+    }
+
     const auto packetBuffer = std::make_shared<PacketBuffer>(
         reinterpret_cast<GenericPacketHeader*>(packetHeader),
         packetDataPtr,
@@ -213,10 +425,7 @@ void PacketStreamingServer::addDataPacket(const uint32_t signalId, DataPacket&&
         }
     );
 
-    if constexpr (isPacketRValue)
-        packet.release();
-
-    queue.push(packetBuffer);
+    return packetBuffer;
 }
 
 void PacketStreamingServer::checkAndSendReleasePacket(bool force)
@@ -274,4 +483,127 @@ void PacketStreamingServer::addAlreadySentPacket(uint32_t signalId, Int packetId
     queue.push(packetBuffer);
 }
 
+PacketBufferPtr PacketStreamingServer::createCompressedDataPacketBuffer(DataPacketHeader* packetHeader,
+                                                                        const DataPacketPtr& packet,
+                                                                        std::vector<uint8_t>& compressionBuffer)
+{
+    const auto sampleType = PacketCompression::getPayloadSampleType(packet.getDataDescriptor());
+    if (PacketCompression::getCodec(sampleType) == PacketCompressionCodec::none)
+        return nullptr;
+
+    const auto packetDataSize = static_cast<size_t>(packetHeader->genericHeader.payloadSize);
+    const auto valueSize = getSampleSize(sampleType);
+    if (packetDataSize % valueSize != 0)
+        return nullptr;
+
+    const auto valueCount = packetDataSize / valueSize;
+    const auto maxCompressedSize = PacketCompression::getMaxCompressedSize(valueCount, valueSize);
+    if (compressionBuffer.size() < maxCompressedSize)
+        compressionBuffer.resize(maxCompressedSize);
+
+    const auto compressedSize = PacketCompression::compress(sampleType, packet.getRawData(), valueCount, compressionBuffer.data());
+
+    // send uncompressed data if compression does not pay off, e.g. for noise
+    if (compressedSize >= packetDataSize)
+        return nullptr;
+
+    const auto compressedData = static_cast<uint8_t*>(std::malloc(compressedSize));
+    std::memcpy(compressedData, compressionBuffer.data(), compressedSize);
+
+    packetHeader->genericHeader.flags |= PACKET_FLAG_COMPRESSED;
+    packetHeader->genericHeader.payloadSize = static_cast<uint32_t>(compressedSize);
+
+    return std::make_shared<PacketBuffer>(
+        reinterpret_cast<GenericPacketHeader*>(packetHeader),
+        compressedData,
+        [packetHeader, compressedData]()
+        {
+            std::free(packetHeader);
+            std::free(compressedData);
+        });
+}
+
+SharedPacketEncoding::SharedPacketEncoding(uint32_t signalId, PacketPtr packet, SerializerPtr jsonSerializer)
+    : signalId(signalId)
+    , packet(std::move(packet))
+    , jsonSerializer(std::move(jsonSerializer))
+{
+}
+
+uint32_t SharedPacketEncoding::getSignalId() const
+{
+    return signalId;
+}
+
+const PacketPtr& SharedPacketEncoding::getPacket() const
+{
+    return packet;
+}
+
+PacketBufferPtr SharedPacketEncoding::getDataPacketBuffer(std::vector<uint8_t>* compressionBuffer)
+{
+    auto& packetBuffer = dataPacketBuffers[compressionBuffer != nullptr];
+    if (!packetBuffer)
+        packetBuffer = PacketStreamingServer::createDataPacketBuffer(signalId, packet, false, compressionBuffer);
+    return packetBuffer;
+}
+
+PacketBufferPtr SharedPacketEncoding::getJsonEventPacketBuffer()
+{
+    if (!jsonEventPacketBuffer)
+        jsonEventPacketBuffer = PacketStreamingServer::createEventPacketBuffer(signalId, packet, getSerializer());
+    return jsonEventPacketBuffer;
+}
+
+const std::string& SharedPacketEncoding::getDescriptorDefinition(bool domain)
+{
+    auto& definition = descriptorDefinitions[domain];
+    if (!definition)
+    {
+        const DataDescriptorPtr descriptor = EventPacketPtr(packet).getParameters().get(
+            domain ? event_packet_param::DOMAIN_DATA_DESCRIPTOR : event_packet_param::DATA_DESCRIPTOR);
+
+        const auto& serializer = getSerializer();
+        serializer.reset();
+        descriptor.serialize(serializer);
+        definition = serializer.getOutput().toStdString();
+    }
+
+    return *definition;
+}
+
+PacketBufferPtr SharedPacketEncoding::getBinaryDescriptorChangedPacketBuffer(uint32_t valueDescriptorId,
+                                                                             uint32_t domainDescriptorId,
+                                                                             bool defineValue,
+                                                                             bool defineDomain)
+{
+    // clients whose descriptor caches are in the same state receive the same buffer
+    for (const auto& encoding : binaryEncodings)
+        if (encoding.valueDescriptorId == valueDescriptorId && encoding.domainDescriptorId == domainDescriptorId &&
+            encoding.defineValue == defineValue && encoding.defineDomain == defineDomain)
+            return encoding.packetBuffer;
+
+    std::vector<std::pair<uint32_t, const std::string*>> definitions;
+    if (defineValue)
+        definitions.emplace_back(valueDescriptorId, &getDescriptorDefinition(false));
+    if (defineDomain)
+        definitions.emplace_back(domainDescriptorId, &getDescriptorDefinition(true));
+
+    DescriptorChangedEventPayload payloadHeader;
+    payloadHeader.valueDescriptorId = valueDescriptorId;
+    payloadHeader.domainDescriptorId = domainDescriptorId;
+    payloadHeader.definitionCount = static_cast<uint32_t>(definitions.size());
+
+    auto packetBuffer = PacketStreamingServer::createBinaryDescriptorChangedPacketBuffer(signalId, payloadHeader, definitions);
+    binaryEncodings.push_back({valueDescriptorId, domainDescriptorId, defineValue, defineDomain, packetBuffer});
+    return packetBuffer;
+}
+
+const SerializerPtr& SharedPacketEncoding::getSerializer()
+{
+    if (!jsonSerializer.assigned())
+        jsonSerializer = JsonSerializer();
+    return jsonSerializer;
+}
+
 }
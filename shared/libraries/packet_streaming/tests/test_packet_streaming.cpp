@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include <packet_streaming/packet_streaming_client.h>
 #include <packet_streaming/packet_streaming_server.h>
+#include <packet_streaming/packet_compression.h>
 #include <opendaq/packet_factory.h>
 #include <opendaq/data_descriptor_factory.h>
 #include <opendaq/data_rule_factory.h>
@@ -65,6 +66,59 @@ TEST_F(PacketStreamingTest, EventPacket)
     ASSERT_EQ(descriptorEventPacket, clientEventPacket);
 }
 
+TEST_F(PacketStreamingTest, BinaryEncodedDescriptorChangedEventPacket)
+{
+    server.setVersion(PACKET_STREAMING_VERSION_BINARY_EVENTS);
+
+    const auto valueDescriptor1 = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto valueDescriptor2 = DataDescriptorBuilder().setSampleType(SampleType::Int16).build();
+    const auto domainDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int64).build();
+
+    const auto serverEventPacket1 = DataDescriptorChangedEventPacket(valueDescriptor1, domainDescriptor);
+    const auto serverEventPacket2 = DataDescriptorChangedEventPacket(valueDescriptor2, domainDescriptor);
+    const auto serverEventPacket3 = DataDescriptorChangedEventPacket(
+        DataDescriptorBuilder().setSampleType(SampleType::Float32).build(), domainDescriptor);
+
+    server.addDaqPacket(1, serverEventPacket1);
+    server.addDaqPacket(1, serverEventPacket1);
+    server.addDaqPacket(1, serverEventPacket2);
+    server.addDaqPacket(1, serverEventPacket3);
+
+    std::vector<uint32_t> payloadSizes;
+    while (const auto serverPacketBuffer = server.getNextPacketBuffer())
+    {
+        ASSERT_EQ(serverPacketBuffer->packetHeader->version, PACKET_STREAMING_VERSION_BINARY_EVENTS);
+        payloadSizes.push_back(serverPacketBuffer->packetHeader->payloadSize);
+
+        transmission.sendPacketBuffer(serverPacketBuffer);
+        while (const auto clientPacketBuffer = transmission.recvPacketBuffer())
+            client.addPacketBuffer(clientPacketBuffer);
+    }
+
+    // descriptors already known by the client are only referenced by ID
+    ASSERT_EQ(payloadSizes.size(), 4u);
+    ASSERT_GT(payloadSizes[0], sizeof(DescriptorChangedEventPayload));
+    ASSERT_EQ(payloadSizes[1], sizeof(DescriptorChangedEventPayload));
+    ASSERT_GT(payloadSizes[2], sizeof(DescriptorChangedEventPayload));
+    ASSERT_EQ(payloadSizes[3], sizeof(DescriptorChangedEventPayload));
+
+    // repeated descriptor changed event packet is dropped
+    auto [signalId1, clientEventPacket1] = client.getNextDaqPacket();
+    auto [signalId2, clientEventPacket2] = client.getNextDaqPacket();
+    auto [signalId3, clientEventPacket3] = client.getNextDaqPacket();
+    auto [signalId4, clientEventPacket4] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalId1, 1u);
+    ASSERT_EQ(signalId2, 1u);
+    ASSERT_EQ(signalId3, 1u);
+    ASSERT_FALSE(clientEventPacket4.assigned());
+
+    ASSERT_EQ(serverEventPacket1, clientEventPacket1);
+    ASSERT_EQ(serverEventPacket2, clientEventPacket2);
+    ASSERT_EQ(serverEventPacket3, clientEventPacket3);
+    ASSERT_EQ(client.getDataDescriptorChangedEventPacket(1), serverEventPacket3);
+}
+
 TEST_F(PacketStreamingTest, DataPacket)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
@@ -96,6 +150,205 @@ TEST_F(PacketStreamingTest, DataPacket)
     ASSERT_TRUE(client.areReferencesCleared());
 }
 
+TEST_F(PacketStreamingTest, EncodedPacketSharedBetweenServers)
+{
+    PacketStreamingServer secondServer {10};
+    PacketStreamingClient secondClient;
+    PacketTransmission secondTransmission;
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto serverDataDescriptorChangedEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, nullptr);
+
+    constexpr size_t sampleCount = 100;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount, 1024);
+    auto data = static_cast<float*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data++ = static_cast<float>(i);
+
+    for (const PacketPtr& packet : {PacketPtr(serverDataDescriptorChangedEventPacket), PacketPtr(serverDataPacket)})
+    {
+        SharedPacketEncoding encoding(1, packet);
+        server.addEncodedDaqPacket(encoding);
+        secondServer.addEncodedDaqPacket(encoding);
+    }
+
+    transmitAll();
+    while (const auto serverPacketBuffer = secondServer.getNextPacketBuffer())
+    {
+        secondTransmission.sendPacketBuffer(serverPacketBuffer);
+        while (const auto clientPacketBuffer = secondTransmission.recvPacketBuffer())
+            secondClient.addPacketBuffer(clientPacketBuffer);
+    }
+
+    for (auto* packetClient : {&client, &secondClient})
+    {
+        auto [signalIdDataDescriptorChangedEventPacket, clientDataDescriptorChangedEventPacket] = packetClient->getNextDaqPacket();
+        auto [signalIdOfDataPacket, clientDataPacket] = packetClient->getNextDaqPacket();
+
+        ASSERT_EQ(signalIdDataDescriptorChangedEventPacket, 1u);
+        ASSERT_EQ(signalIdOfDataPacket, 1u);
+        ASSERT_EQ(serverDataDescriptorChangedEventPacket, clientDataDescriptorChangedEventPacket);
+        ASSERT_EQ(serverDataPacket, clientDataPacket);
+    }
+}
+
+TEST_F(PacketStreamingTest, BinaryEncodedEventSharedBetweenServers)
+{
+    PacketStreamingServer secondServer {10};
+    server.setVersion(PACKET_STREAMING_VERSION_BINARY_EVENTS);
+    secondServer.setVersion(PACKET_STREAMING_VERSION_BINARY_EVENTS);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    SharedPacketEncoding encoding(1, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+    server.addEncodedDaqPacket(encoding);
+    secondServer.addEncodedDaqPacket(encoding);
+
+    // both clients have empty descriptor caches, so they receive the same definition
+    const auto packetBuffer = server.getNextPacketBuffer();
+    ASSERT_EQ(packetBuffer->packetHeader->version, PACKET_STREAMING_VERSION_BINARY_EVENTS);
+    ASSERT_EQ(packetBuffer, secondServer.getNextPacketBuffer());
+}
+
+TEST_F(PacketStreamingTest, RedefinedDescriptorNotForwarded)
+{
+    server.setVersion(PACKET_STREAMING_VERSION_BINARY_EVENTS);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
+    const auto eventPacket = DataDescriptorChangedEventPacket(valueDescriptor, nullptr);
+    server.addDaqPacket(1, eventPacket);
+
+    // evict the descriptor of signal 1 from the descriptor cache
+    for (size_t i = 0; i < PACKET_STREAMING_DESCRIPTOR_CACHE_SIZE; ++i)
+    {
+        const auto descriptor = DataDescriptorBuilder().setSampleType(SampleType::Int32).setName(std::to_string(i)).build();
+        server.addDaqPacket(2, DataDescriptorChangedEventPacket(descriptor, nullptr));
+    }
+
+    server.addDaqPacket(1, eventPacket);
+    transmitAll();
+
+    std::vector<PacketPtr> signal1Packets;
+    while (true)
+    {
+        auto [signalId, packet] = client.getNextDaqPacket();
+        if (!packet.assigned())
+            break;
+        if (signalId == 1)
+            signal1Packets.push_back(packet);
+    }
+
+    // the descriptor is defined again, but it did not change
+    ASSERT_EQ(signal1Packets.size(), 1u);
+    ASSERT_EQ(signal1Packets[0], eventPacket);
+}
+
+TEST_F(PacketStreamingTest, CompressedDataPacket)
+{
+    server.setCompressionEnabled(true);
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int16).build();
+    const auto serverDataDescriptorChangedEventPacket = DataDescriptorChangedEventPacket(valueDescriptor, nullptr);
+    server.addDaqPacket(1, serverDataDescriptorChangedEventPacket);
+
+    constexpr size_t sampleCount = 1000;
+    auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+    auto data = static_cast<int16_t*>(serverDataPacket.getRawData());
+    for (size_t i = 0; i < sampleCount; i++)
+        *data++ = static_cast<int16_t>(1000 + i / 10);
+
+    server.addDaqPacket(1, serverDataPacket);
+
+    std::vector<PacketBufferPtr> serverPacketBuffers;
+    while (const auto serverPacketBuffer = server.getNextPacketBuffer())
+        serverPacketBuffers.push_back(serverPacketBuffer);
+
+    ASSERT_EQ(serverPacketBuffers.size(), 2u);
+    ASSERT_TRUE(serverPacketBuffers[1]->packetHeader->flags & PACKET_FLAG_COMPRESSED);
+    ASSERT_LT(serverPacketBuffers[1]->packetHeader->payloadSize, sampleCount * sizeof(int16_t) / 4);
+
+    for (const auto& serverPacketBuffer : serverPacketBuffers)
+    {
+        transmission.sendPacketBuffer(serverPacketBuffer);
+        while (const auto clientPacketBuffer = transmission.recvPacketBuffer())
+            client.addPacketBuffer(clientPacketBuffer);
+    }
+
+    auto [signalIdDataDescriptorChangedEventPacket, clientDataDescriptorChangedEventPacket] = client.getNextDaqPacket();
+    auto [signalIdOfDataPacket, clientDataPacket] = client.getNextDaqPacket();
+
+    ASSERT_EQ(signalIdOfDataPacket, 1u);
+    ASSERT_EQ(serverDataPacket, clientDataPacket);
+}
+
+TEST_F(PacketStreamingTest, SignalCompressionOverride)
+{
+    server.setSignalCompressionEnabled(1, true);
+    server.setSignalCompressionEnabled(2, false);
+    ASSERT_TRUE(server.isCompressionEnabled(1));
+    ASSERT_FALSE(server.isCompressionEnabled(2));
+    ASSERT_FALSE(server.isCompressionEnabled(3));
+
+    server.setCompressionEnabled(true);
+    ASSERT_FALSE(server.isCompressionEnabled(2));
+    ASSERT_TRUE(server.isCompressionEnabled(3));
+
+    const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Int16).build();
+    constexpr size_t sampleCount = 1000;
+
+    for (uint32_t signalId = 1; signalId <= 2; ++signalId)
+    {
+        server.addDaqPacket(signalId, DataDescriptorChangedEventPacket(valueDescriptor, nullptr));
+
+        auto serverDataPacket = DataPacket(valueDescriptor, sampleCount);
+        auto data = static_cast<int16_t*>(serverDataPacket.getRawData());
+        for (size_t i = 0; i < sampleCount; i++)
+            *data++ = static_cast<int16_t>(1000 + i / 10);
+
+        server.addDaqPacket(signalId, serverDataPacket);
+    }
+
+    std::vector<PacketBufferPtr> serverPacketBuffers;
+    while (const auto serverPacketBuffer = server.getNextPacketBuffer())
+        serverPacketBuffers.push_back(serverPacketBuffer);
+
+    ASSERT_EQ(serverPacketBuffers.size(), 4u);
+    ASSERT_TRUE(serverPacketBuffers[1]->packetHeader->flags & PACKET_FLAG_COMPRESSED);
+    ASSERT_FALSE(serverPacketBuffers[3]->packetHeader->flags & PACKET_FLAG_COMPRESSED);
+
+    server.setSignalCompressionEnabled(2, std::nullopt);
+    ASSERT_TRUE(server.isCompressionEnabled(2));
+}
+
+TEST(PacketCompressionTest, RoundTrip)
+{
+    constexpr size_t valueCount = 1000;
+
+    std::vector<int64_t> intValues(valueCount);
+    std::vector<double> floatValues(valueCount);
+    for (size_t i = 0; i < valueCount; i++)
+    {
+        intValues[i] = (i % 3 == 0) ? std::numeric_limits<int64_t>::min() : static_cast<int64_t>(i * i);
+        floatValues[i] = (i % 7 == 0) ? -0.5 : static_cast<double>(i) / 8.0;
+    }
+
+    std::vector<uint8_t> compressed(PacketCompression::getMaxCompressedSize(valueCount, sizeof(int64_t)));
+
+    auto compressedSize = PacketCompression::compress(SampleType::Int64, intValues.data(), valueCount, compressed.data());
+    ASSERT_LE(compressedSize, compressed.size());
+    std::vector<int64_t> decompressedIntValues(valueCount);
+    PacketCompression::decompress(SampleType::Int64, compressed.data(), compressedSize, decompressedIntValues.data(), valueCount);
+    ASSERT_EQ(intValues, decompressedIntValues);
+
+    compressedSize = PacketCompression::compress(SampleType::Float64, floatValues.data(), valueCount, compressed.data());
+    ASSERT_LE(compressedSize, compressed.size());
+    std::vector<double> decompressedFloatValues(valueCount);
+    PacketCompression::decompress(SampleType::Float64, compressed.data(), compressedSize, decompressedFloatValues.data(), valueCount);
+    ASSERT_EQ(floatValues, decompressedFloatValues);
+
+    ASSERT_THROW(PacketCompression::decompress(SampleType::Float64, compressed.data(), compressedSize / 2, decompressedFloatValues.data(), valueCount),
+                 PacketStreamingException);
+}
+
 TEST_F(PacketStreamingTest, CanReleaseDataPacket)
 {
     const auto valueDescriptor = DataDescriptorBuilder().setSampleType(SampleType::Float32).build();
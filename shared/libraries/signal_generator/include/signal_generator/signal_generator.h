@@ -27,11 +27,15 @@ class SignalGenerator
 {
 public:
     using GenerateSampleFunc = std::function<void(uint64_t tick, void* valueOut)>;
+    // Fills `sampleCount` consecutive samples starting at `startTick`; called once per packet
+    using GenerateBlockFunc = std::function<void(uint64_t startTick, size_t sampleCount, void* valuesOut)>;
     using UpdateGeneratorFunc = std::function<void(SignalGenerator& generator, uint64_t packetOffset)>;
 
     SignalGenerator(const SignalConfigPtr& signal);
 
     void setFunction(GenerateSampleFunc function);
+    // Replaces the per-sample function, so the generator does not make a call per sample
+    void setBlockFunction(GenerateBlockFunc function);
     void setUpdateFunction(UpdateGeneratorFunc function);
     void generateSamplesTo(std::chrono::milliseconds currentTime);
     SignalConfigPtr getSignal();
@@ -45,6 +49,7 @@ protected:
 
     SignalConfigPtr signal;
     GenerateSampleFunc generateFunc;
+    GenerateBlockFunc generateBlockFunc;
     UpdateGeneratorFunc updateFunc;
     uint64_t tick;
     size_t sampleSize{};
@@ -21,6 +21,12 @@ SignalGenerator::SignalGenerator(const SignalConfigPtr& signal)
 void SignalGenerator::setFunction(GenerateSampleFunc function)
 {
     this->generateFunc = function;
+    this->generateBlockFunc = nullptr;
+}
+
+void SignalGenerator::setBlockFunction(GenerateBlockFunc function)
+{
+    this->generateBlockFunc = function;
 }
 
 void SignalGenerator::setUpdateFunction(UpdateGeneratorFunc function)
@@ -50,13 +56,20 @@ void SignalGenerator::generatePacket(uint64_t startTick, size_t sampleCount)
     auto domainPacket = DataPacket(domainDescriptor, sampleCount, (Int) packetOffset);
     auto dataPacket = DataPacketWithDomain(domainPacket, dataDescriptor, sampleCount);
 
-    uint8_t* currentSample = (uint8_t*) dataPacket.getRawData();
-    const size_t lastTick = startTick + sampleCount;
-
-    for (uint64_t i = startTick; i < lastTick; i++)
+    if (generateBlockFunc)
+    {
+        generateBlockFunc(startTick, sampleCount, dataPacket.getRawData());
+    }
+    else
     {
-        generateFunc(i, currentSample);
-        currentSample += sampleSize;
+        uint8_t* currentSample = (uint8_t*) dataPacket.getRawData();
+        const size_t lastTick = startTick + sampleCount;
+
+        for (uint64_t i = startTick; i < lastTick; i++)
+        {
+            generateFunc(i, currentSample);
+            currentSample += sampleSize;
+        }
     }
 
     signal.sendPacket(dataPacket);
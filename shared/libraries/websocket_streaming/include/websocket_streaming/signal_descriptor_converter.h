@@ -50,5 +50,7 @@ private:
     static void DecodeInterpretationObject(const nlohmann::json& extra, DataDescriptorBuilderPtr& dataDescriptor);
     static nlohmann::json DictToJson(const DictPtr<IString, IBaseObject>& dict);
     static DictPtr<IString, IBaseObject> JsonToDict(const nlohmann::json& json);
+    static nlohmann::json ListToJson(const ListPtr<IBaseObject>& list);
+    static ListPtr<IBaseObject> JsonToList(const nlohmann::json& json);
 };
 END_NAMESPACE_OPENDAQ_WEBSOCKET_STREAMING
@@ -421,7 +421,7 @@ nlohmann::json SignalDescriptorConverter::DictToJson(const DictPtr<IString, IBas
     for (const auto& [key, value] : dict)
     {
         if (value.asPtrOrNull<IList>().assigned())
-            json[key.getCharPtr()] = value.asPtr<IList>().toVector();
+            json[key.getCharPtr()] = ListToJson(value);
         else if (value.asPtrOrNull<IDict>().assigned())
             json[key.getCharPtr()] = DictToJson(value);
         else if (value.asPtrOrNull<IFloat>().assigned())
@@ -443,10 +443,7 @@ DictPtr<IString, IBaseObject> SignalDescriptorConverter::JsonToDict(const nlohma
     for (const auto& entry : items)
     {
         if (entry.value().is_array())
-        {
-            auto vect = entry.value().get<std::vector<BaseObjectPtr>>();
-            dict[entry.key()] = ListPtr<IBaseObject>::FromVector(vect);
-        }
+            dict[entry.key()] = JsonToList(entry.value());
         else if (entry.value().is_object())
             dict[entry.key()] = JsonToDict(entry.value());
         else if (entry.value().is_number_float())
@@ -460,4 +457,47 @@ DictPtr<IString, IBaseObject> SignalDescriptorConverter::JsonToDict(const nlohma
     return dict;
 }
 
+// Numeric items are converted explicitly, so that lists such as polynomial scaling coefficients keep their values
+nlohmann::json SignalDescriptorConverter::ListToJson(const ListPtr<IBaseObject>& list)
+{
+    auto json = nlohmann::json::array();
+
+    for (const auto& item : list)
+    {
+        if (item.asPtrOrNull<IList>().assigned())
+            json.push_back(ListToJson(item));
+        else if (item.asPtrOrNull<IDict>().assigned())
+            json.push_back(DictToJson(item));
+        else if (item.asPtrOrNull<IFloat>().assigned())
+            json.push_back((Float) item);
+        else if (item.asPtrOrNull<IInteger>().assigned())
+            json.push_back((Int) item);
+        else
+            json.push_back(item);
+    }
+
+    return json;
+}
+
+ListPtr<IBaseObject> SignalDescriptorConverter::JsonToList(const nlohmann::json& json)
+{
+    auto list = List<IBaseObject>();
+
+    for (const auto& item : json)
+    {
+        if (item.is_array())
+            list.pushBack(JsonToList(item));
+        else if (item.is_object())
+            list.pushBack(JsonToDict(item));
+        else if (item.is_number_float())
+            list.pushBack(item.get<Float>());
+        else if (item.is_number_integer())
+            list.pushBack(item.get<Int>());
+        else
+            list.pushBack(item.get<BaseObjectPtr>());
+    }
+
+    return list;
+}
+
 END_NAMESPACE_OPENDAQ_WEBSOCKET_STREAMING
@@ -341,4 +341,22 @@ TEST(SignalConverter, subscribedTimeSignal)
     ASSERT_EQ(resultStart, startTime);
 }
 
+TEST(SignalConverter, encodePolynomialScaling)
+{
+    auto descriptor = DataDescriptorBuilder()
+                          .setSampleType(SampleType::Float64)
+                          .setPostScaling(PolynomialScaling(List<INumber>(0.5, 2, -0.25), SampleType::Int32))
+                          .build();
+
+    nlohmann::json extra;
+    SignalDescriptorConverter::EncodeInterpretationObject(descriptor, extra);
+
+    auto coefficients = extra["scaling"]["parameters"]["coefficients"];
+    ASSERT_EQ(extra["scaling"]["scalingType"], ScalingType::Polynomial);
+    ASSERT_EQ(coefficients.size(), 3u);
+    ASSERT_EQ(coefficients[0].get<Float>(), 0.5);
+    ASSERT_EQ(coefficients[1].get<Int>(), 2);
+    ASSERT_EQ(coefficients[2].get<Float>(), -0.25);
+}
+
 END_NAMESPACE_OPENDAQ_WEBSOCKET_STREAMING
@@ -151,3 +151,41 @@ TEST_F(SignalGeneratorTest, ChangeFunction)
     ASSERT_EQ(packet2.getSampleCount(), packetSize);
     ASSERT_TRUE(compareSamples(expectedSamples2.data(), packet2.getData(), packetSize));
 }
+
+TEST_F(SignalGeneratorTest, BlockFunction)
+{
+    const size_t packetSize = 100;
+
+    auto expectedSamples1 = calculateExpectedSamples(0, packetSize, stepFunction10);
+    auto expectedSamples2 = calculateExpectedSamples(packetSize, packetSize, stepFunction10);
+
+    auto reader = PacketReader(signal);
+
+    size_t blockCount = 0;
+    auto blockFunction = [&blockCount](uint64_t startTick, size_t sampleCount, void* samplesOut)
+    {
+        int* intOut = (int*) samplesOut;
+        for (size_t i = 0; i < sampleCount; i++)
+            intOut[i] = (startTick + i) % 10;
+        blockCount++;
+    };
+
+    auto generator = SignalGenerator(signal);
+    generator.setFunction(stepFunction100);
+    generator.setBlockFunction(blockFunction);
+    generator.generateSamplesTo(std::chrono::milliseconds(packetSize));
+    generator.generateSamplesTo(std::chrono::milliseconds(packetSize * 2));
+
+    ASSERT_EQ(blockCount, 2u);
+
+    auto packets = reader.readAll();
+    ASSERT_EQ(packets.getCount(), 3u);
+
+    auto packet1 = packets[1].asPtr<IDataPacket>();
+    ASSERT_EQ(packet1.getSampleCount(), packetSize);
+    ASSERT_TRUE(compareSamples(expectedSamples1.data(), packet1.getData(), packetSize));
+
+    auto packet2 = packets[2].asPtr<IDataPacket>();
+    ASSERT_EQ(packet2.getSampleCount(), packetSize);
+    ASSERT_TRUE(compareSamples(expectedSamples2.data(), packet2.getData(), packetSize));
+}